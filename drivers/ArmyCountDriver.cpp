@@ -0,0 +1,58 @@
+/**
+ * @file ArmyCountDriver.cpp
+ * @brief Driver for the saturating 64-bit army counts
+ *
+ * @details Shows the clamping of Armies arithmetic at 0 and Armies::MAX, and a territory that is
+ *          blockaded over and over until its armies saturate instead of overflowing.
+ */
+
+#include <iostream>
+#include <limits>
+#include "../include/ArmyCount.h"
+#include "../include/GameContext.h"
+#include "../include/Map.h"
+#include "../include/Orders.h"
+#include "../include/Player.h"
+
+// Importing only the neccessary std functions.
+using std::cout;
+
+/**
+ * @brief Demonstrates Armies::add/subtract/twice and repeated Blockade doubling
+ * @details The blockaded territory is handed back to Alice after every Blockade so she can play
+ *          the next one; an int would have overflowed after 31 doublings.
+ */
+void testArmyCount() {
+    cout << "\n=== testArmyCount ===\n";
+
+    cout << "Armies::MAX = " << Armies::MAX << "\n";
+    cout << "add(MAX, 1) = " << Armies::add(Armies::MAX, 1) << "\n";
+    cout << "add(MAX, INT64_MAX) = " << Armies::add(Armies::MAX, std::numeric_limits<ArmyCount>::max()) << "\n";
+    cout << "subtract(3, 5) = " << Armies::subtract(3, 5) << "\n";
+    cout << "twice(MAX / 2 + 1) = " << Armies::twice(Armies::MAX / 2 + 1) << "\n";
+
+    Player alice("Alice");
+    GameContext game;
+    alice.setGameContext(&game);
+    Map m;
+    Territory* fort = new Territory(1, "Fort");
+    m.addTerritory(fort);
+    alice.addPlayerTerritory(fort);
+    fort->setArmies(3);
+
+    Player* neutral = game.getNeutralPlayer();
+    int blockades = 0;
+    while (blockades < 60) {
+        BlockadeOrder blockade(&alice, fort);
+        blockade.execute();
+        ++blockades;
+        if (blockades == 31 || fort->getArmies() == Armies::MAX) {
+            cout << "After " << blockades << " Blockades: " << fort->getArmies() << " armies (owner "
+                 << fort->getOwner()->getPlayerName() << ")\n";
+        }
+        if (fort->getArmies() == Armies::MAX) break;
+        neutral->removePlayerTerritory(fort); // hand it back for the next Blockade
+        alice.addPlayerTerritory(fort);
+    }
+    cout << "Saturated at Armies::MAX: " << (fort->getArmies() == Armies::MAX ? "yes" : "no") << "\n";
+}
@@ -0,0 +1,739 @@
+/**
+ * @file CommandLineDriver.cpp
+ * @brief Headless command-line entry point with subcommands.
+ *
+ * @details
+ *  `main` forwards its arguments to `runCommandLine()` before running any demo driver.
+ *  When the first argument is a subcommand, only what that mode needs is initialized:
+ *
+ *    warzone_test tournament -M <maps> -P <strategies> -G <games> -D <turns> [-batch] [-profile] [-orders <n>] [-think <ms>] [-rules <file>] [-progress <seconds>] [-status <file>]
+ *    warzone_test validate-maps [<directory>]
+ *    warzone_test pack-maps [<directory>]
+ *    warzone_test export-map <map file> <output.map | output.json>
+ *    warzone_test play -file <commands.txt> [-D <turns>] [-state <game.state>] [-json <state.json>] [-coalesce] [-renumber] [-profile] [-orders <n>] [-think <ms>] [-rules <file>]
+ *    warzone_test resume <game.state> [-D <turns>] [-json <state.json>] [-renumber] [-profile] [-orders <n>] [-think <ms>] [-rules <file>]
+ *    warzone_test bench [-M <maps>] [-G <games>] [-D <turns>] [-K <lanes>] [-coalesce] [-renumber] [-profile] [-orders <n>] [-think <ms>] [-rules <file>]
+ *    warzone_test replay [<gamelog.txt>]
+ *
+ *  Any other argument list (none, `-console`, `-file <name>`) runs the demo drivers as before.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <filesystem>
+#include <stdexcept>
+#include "../include/GameEngine.h"
+#include "../include/CommandProcessing.h"
+#include "../include/Map.h"
+#include "../include/MapIndex.h"
+#include "../include/MapArchive.h"
+#include "../include/GameStateFile.h"
+#include "../include/BatchSimulation.h"
+#include "../include/BattleResolver.h"
+#include "../include/GameRules.h"
+#include "../include/PerfCounters.h"
+#include "../include/MapWriter.h"
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::string;
+using std::vector;
+
+namespace {
+    using BenchClock = std::chrono::steady_clock;
+
+    const int DEFAULT_PLAY_TURNS = 100;
+    const int DEFAULT_BENCH_GAMES = 3;
+    const int DEFAULT_BENCH_TURNS = 20;
+    const int BENCH_MAP_LOADS = 20;
+    const int DEFAULT_BENCH_LANES = 64;
+    const int BENCH_BATTLES = 200000;
+    const int BENCH_NEIGHBOUR_WALKS = 20;
+    const int BENCH_LARGE_NEIGHBOUR_WALKS = 3;
+    const long long DEFAULT_LLC_BYTES = 32LL * 1024 * 1024;
+    const int LOCALITY_TERRITORY_BYTES = 288; // a territory, its name and its neighbour and continent lists
+    const int LOCALITY_GRID_BAND = 16;        // rows of the generated grid per continent
+    const int BENCH_MAP_WRITES = 20;
+    const int DEFAULT_PROGRESS_SECONDS = 5; // tournament progress period when only -status is given
+
+    /** @brief Silences std::cout for the lifetime of the object (engine output during benchmarks) */
+    class QuietCout {
+    public:
+        QuietCout() : saved(cout.rdbuf(nullptr)) {}
+        ~QuietCout() { cout.rdbuf(saved); }
+        QuietCout(const QuietCout&) = delete;
+        QuietCout& operator=(const QuietCout&) = delete;
+    private:
+        std::streambuf* saved;
+    };
+
+    /** @brief Milliseconds elapsed since a time point */
+    double millisecondsSince(BenchClock::time_point start) {
+        return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+    }
+
+    /**
+     * @brief Time the scalar and batch battle resolvers on the same random battles
+     * @details Each side is drawn from one of three sizes: a usual stack (1 to 30), a stack just
+     *          above GameRules::BATTLE_BULK_THRESHOLD, or a saturated-scale stack up to Armies::MAX,
+     *          so the bulk rounds of both resolvers are compared as well as the round-by-round tail.
+     * @return true if both produced identical results
+     */
+    bool benchBattles() {
+        std::mt19937_64 gen(std::random_device{}());
+        std::uniform_int_distribution<int> size(0, 3); // half usual, a quarter large, a quarter huge
+        std::uniform_int_distribution<ArmyCount> usual(1, 30);
+        std::uniform_int_distribution<ArmyCount> large(GameRules::BATTLE_BULK_THRESHOLD + 1, 16 * GameRules::BATTLE_BULK_THRESHOLD);
+        std::uniform_int_distribution<ArmyCount> huge(16 * GameRules::BATTLE_BULK_THRESHOLD + 1, Armies::MAX);
+        auto draw = [&]() {
+            switch (size(gen)) {
+                case 2: return large(gen);
+                case 3: return huge(gen);
+                default: return usual(gen);
+            }
+        };
+
+        vector<ArmyCount> attackers(BENCH_BATTLES), defenders(BENCH_BATTLES);
+        vector<std::uint64_t> seeds(BENCH_BATTLES);
+        int bulk = 0;
+        for (int i = 0; i < BENCH_BATTLES; ++i) {
+            attackers[i] = draw();
+            defenders[i] = draw();
+            seeds[i] = gen();
+            if (std::min(attackers[i], defenders[i]) > GameRules::BATTLE_BULK_THRESHOLD) ++bulk;
+        }
+        vector<ArmyCount> scalarAttackers = attackers, scalarDefenders = defenders;
+
+        BenchClock::time_point start = BenchClock::now();
+        for (int i = 0; i < BENCH_BATTLES; ++i) {
+            GameRules::resolveBattleSeeded<ActiveRules>(scalarAttackers[i], scalarDefenders[i], seeds[i]);
+        }
+        const double scalarMs = millisecondsSince(start);
+
+        start = BenchClock::now();
+        GameRules::resolveBattles<ActiveRules>(attackers.data(), defenders.data(), seeds.data(), seeds.size());
+        const double batchMs = millisecondsSince(start);
+
+        const bool identical = attackers == scalarAttackers && defenders == scalarDefenders;
+        cout << "Battles: " << BENCH_BATTLES << " (" << bulk << " above the bulk threshold) scalar " << scalarMs << " ms, batch of "
+             << GameRules::BATTLE_LANES << " lanes " << batchMs << " ms, "
+             << (identical ? "identical results" : "RESULTS DIFFER") << endl;
+        return identical;
+    }
+
+    /** @brief One pass over every neighbour of every territory, in storage order, plus a validation if asked */
+    long long walkNeighbours(const Map& map, bool validate) {
+        long long sum = validate && map.validate() ? 1 : 0;
+        for (const Territory* t : map.getTerritories()) {
+            for (const Territory* adj : t->getAdjacents()) sum += adj->getArmies() + adj->getOriginalId();
+        }
+        return sum;
+    }
+
+    /** @brief Walks of a map measured by one PerfScope: time and last-level cache misses per walk */
+    struct WalkCost {
+        double ms = 0.0;
+        double cacheMisses = 0.0;
+        bool hardware = false; // cacheMisses is only counted with hardware perf events
+        long long sum = 0;     // what the walks read, to check that renumbering kept the graph
+    };
+
+    WalkCost measureWalks(const Map& map, int walks, bool validate) {
+        PhaseProfile profile;
+        WalkCost cost;
+        {
+            PerfScope scope(&profile, PerfPhase::NeighbourWalk);
+            for (int i = 0; i < walks; ++i) cost.sum += walkNeighbours(map, validate);
+        }
+        const PerfSample& sample = profile.get(PerfPhase::NeighbourWalk);
+        cost.ms = sample.wallMs / walks;
+        cost.cacheMisses = static_cast<double>(sample.cacheMisses) / walks;
+        cost.hardware = profile.getSource() == PerfSource::Hardware;
+        return cost;
+    }
+
+    /** @brief Time (and cache misses) of the walks of a map as it is, then renumbered for locality */
+    void printLocality(Map& map, int walks, bool validate) {
+        const WalkCost fileOrder = measureWalks(map, walks, validate);
+        const RenumberReport report = map.renumberForLocality();
+        const WalkCost renumbered = measureWalks(map, walks, validate);
+
+        cout << report << "; neighbour walk " << fileOrder.ms << " ms -> " << renumbered.ms << " ms, cache misses ";
+        if (fileOrder.hardware && renumbered.hardware) {
+            cout << static_cast<long long>(fileOrder.cacheMisses) << " -> " << static_cast<long long>(renumbered.cacheMisses);
+        } else {
+            cout << "n/a";
+        }
+        cout << (fileOrder.sum == renumbered.sum ? "" : " (WALKS DIFFER)") << endl;
+    }
+
+    /** @brief Neighbour walks on a map as loaded, then renumbered for locality */
+    void benchLocality(MapLoader& loader, const string& path) {
+        Map map;
+        loader.loadMap(path, map);
+        cout << "      locality: ";
+        printLocality(map, BENCH_NEIGHBOUR_WALKS, true);
+    }
+
+    /** @brief Size of the last-level cache, or a typical desktop size where the system does not say */
+    long long lastLevelCacheBytes() {
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+        const long level3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (level3 > 0) return level3;
+        const long level2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        if (level2 > 0) return level2;
+#endif
+        return DEFAULT_LLC_BYTES;
+    }
+
+    /**
+     * @brief Fill a map with a side x side grid whose territories are created in random order
+     * @details Ids and storage follow creation, so grid neighbours are scattered in memory like the
+     *          territories of a generated map written without any ordering. Every band of
+     *          LOCALITY_GRID_BAND rows is one (connected) continent.
+     */
+    void buildScrambledGrid(Map& map, int side, std::mt19937_64& gen) {
+        const int cells = side * side;
+        vector<int> order(cells);
+        for (int c = 0; c < cells; ++c) order[c] = c;
+        std::shuffle(order.begin(), order.end(), gen);
+
+        for (int band = 0; band * LOCALITY_GRID_BAND < side; ++band) {
+            map.addContinent(new Continent(band + 1, "Band" + std::to_string(band + 1), 1));
+        }
+        vector<Territory*> grid(cells);
+        map.reserveTerritories(cells);
+        for (int i = 0; i < cells; ++i) {
+            const int cell = order[i];
+            Territory* territory = new Territory(i + 1, "T" + std::to_string(cell));
+            Continent* continent = map.getContinents()[cell / side / LOCALITY_GRID_BAND];
+            territory->addContinent(continent);
+            continent->addTerritory(territory);
+            map.addTerritory(territory);
+            grid[cell] = territory;
+        }
+        // Neighbours are added in increasing id order, so the lists are sorted without normalizeAdjacency()
+        for (int cell = 0; cell < cells; ++cell) {
+            Territory* neighbours[4];
+            int count = 0;
+            if (cell % side > 0) neighbours[count++] = grid[cell - 1];
+            if (cell % side + 1 < side) neighbours[count++] = grid[cell + 1];
+            if (cell >= side) neighbours[count++] = grid[cell - side];
+            if (cell + side < cells) neighbours[count++] = grid[cell + side];
+            std::sort(neighbours, neighbours + count, [](const Territory* a, const Territory* b) {
+                return a->getId() < b->getId();
+            });
+            for (int i = 0; i < count; ++i) grid[cell]->addAdjacent(neighbours[i]);
+        }
+    }
+
+    /**
+     * @brief Neighbour walks on a generated grid about twice the size of the last-level cache
+     * @details Small maps fit in the caches whatever their order, so only a board that does not
+     *          shows what renumbering saves: fewer cache misses per walk.
+     */
+    void benchLargeLocality() {
+        const long long cacheBytes = lastLevelCacheBytes();
+        const int side = static_cast<int>(std::ceil(std::sqrt(2.0 * cacheBytes / LOCALITY_TERRITORY_BYTES)));
+        std::mt19937_64 gen(std::random_device{}());
+        Map map;
+        BenchClock::time_point start = BenchClock::now();
+        buildScrambledGrid(map, side, gen);
+        cout << "Locality on a generated " << side << "x" << side << " grid (" << map.getTerritories().size()
+             << " territories, last-level cache " << cacheBytes / (1024 * 1024) << " MiB, built in "
+             << millisecondsSince(start) << " ms): ";
+        printLocality(map, BENCH_LARGE_NEIGHBOUR_WALKS, false); // validation would dominate the walk
+    }
+
+    /** @brief Stream buffer that only counts the bytes written to it (writer benchmarks) */
+    class CountingBuffer : public std::streambuf {
+    public:
+        std::size_t count = 0;
+    protected:
+        int_type overflow(int_type c) override {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) ++count;
+            return traits_type::not_eof(c);
+        }
+        std::streamsize xsputn(const char*, std::streamsize n) override {
+            count += static_cast<std::size_t>(n);
+            return n;
+        }
+    };
+
+    /** @brief Time a writer of the map; prints "<label> <size> KiB at <rate> MB/s" */
+    template <typename Write>
+    void benchWriter(const char* label, Write write) {
+        CountingBuffer sink;
+        std::ostream out(&sink);
+        const BenchClock::time_point start = BenchClock::now();
+        for (int i = 0; i < BENCH_MAP_WRITES; ++i) write(out);
+        const double ms = millisecondsSince(start);
+        const double bytes = static_cast<double>(sink.count) / BENCH_MAP_WRITES;
+        cout << " " << label << " " << static_cast<long long>(bytes / 1024) << " KiB at "
+             << (ms > 0.0 ? bytes * BENCH_MAP_WRITES / (ms * 1000.0) : 0.0) << " MB/s";
+    }
+
+    /** @brief Compare the operator<< printer of a map with the Conquest and JSON writers */
+    void benchWriters(MapLoader& loader, const string& path) {
+        Map map;
+        loader.loadMap(path, map);
+        cout << "      writers:";
+        benchWriter("operator<<", [&](std::ostream& out) { out << map; });
+        benchWriter("| Conquest", [&](std::ostream& out) { MapWriter::writeConquest(map, out); });
+        benchWriter("| JSON", [&](std::ostream& out) { MapWriter::writeJson(map, out); });
+        cout << endl;
+    }
+
+    /** @brief Print the usage of every subcommand */
+    void printUsage() {
+        cerr << "Usage:\n"
+             << "  warzone_test tournament -M <maps> -P <strategies> -G <games> -D <turns> [-batch] [-profile] [-orders <n>] [-think <ms>] [-rules <file>] [-progress <seconds>] [-status <file>]\n"
+             << "  warzone_test validate-maps [<directory>]\n"
+             << "  warzone_test pack-maps [<directory>]\n"
+             << "  warzone_test export-map <map file> <output.map | output.json>\n"
+             << "  warzone_test play -file <commands.txt> [-D <turns>] [-state <game.state>] [-json <state.json>] [-coalesce] [-renumber] [-profile] [-orders <n>] [-think <ms>] [-rules <file>]\n"
+             << "  warzone_test resume <game.state> [-D <turns>] [-json <state.json>] [-renumber] [-profile] [-orders <n>] [-think <ms>] [-rules <file>]\n"
+             << "  warzone_test bench [-M <maps>] [-G <games>] [-D <turns>] [-K <lanes>] [-coalesce] [-renumber] [-profile] [-orders <n>] [-think <ms>] [-rules <file>]\n"
+             << "  warzone_test replay [<gamelog.txt>]\n"
+             << "  warzone_test [-console | -file <commands.txt>]   (demo drivers)\n";
+    }
+
+    /**
+     * @brief Read the integer following an option
+     * @throws std::invalid_argument if the value is missing or not a positive integer
+     */
+    int positiveOption(const vector<string>& args, std::size_t& i) {
+        if (i + 1 >= args.size()) throw std::invalid_argument("Missing value after " + args[i]);
+        const int value = std::stoi(args[++i]);
+        if (value < 1) throw std::invalid_argument(args[i - 1] + " must be at least 1");
+        return value;
+    }
+
+    /** @brief Read the text following an option; throws std::invalid_argument if it is missing */
+    string stringOption(const vector<string>& args, std::size_t& i) {
+        if (i + 1 >= args.size()) throw std::invalid_argument("Missing value after " + args[i]);
+        return args[++i];
+    }
+
+    /**
+     * @brief Install the rule set of a -rules file (the standard rules stay in force without one)
+     * @throws std::invalid_argument if the file is invalid, or changes the rules in a build whose
+     *         rules are fixed at compile time (see GameRules.h)
+     * @throws std::runtime_error if the file cannot be read
+     */
+    void configureRules(const string& path) {
+        if (path.empty()) return;
+        const RuleSet rules = RuleSet::load(path);
+        if (!RULES_CONFIGURABLE && rules != RuleSet()) {
+            throw std::invalid_argument(path + " changes the rules, but this build plays the standard rules;"
+                                        " rebuild with -DWARZONE_RUNTIME_RULES");
+        }
+        RuntimeRules::configure(rules);
+    }
+
+    /** @brief tournament: validated by CommandProcessor, then run by GameEngine */
+    int runTournament(const vector<string>& args) {
+        string command = "tournament";
+        bool batch = false;
+        bool profile = false;
+        int orderBudget = 0;
+        int thinkMs = 0;
+        string rulesPath;
+        int progressSeconds = 0;
+        string statusPath;
+        try {
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                // Engine options are not part of the tournament command
+                if (args[i] == "-batch") batch = true;
+                else if (args[i] == "-profile") profile = true;
+                else if (args[i] == "-orders") orderBudget = positiveOption(args, i);
+                else if (args[i] == "-think") thinkMs = positiveOption(args, i);
+                else if (args[i] == "-rules") rulesPath = stringOption(args, i);
+                else if (args[i] == "-progress") progressSeconds = positiveOption(args, i);
+                else if (args[i] == "-status") {
+                    if (i + 1 >= args.size()) throw std::invalid_argument("Missing file after -status");
+                    statusPath = args[++i];
+                }
+                else command += " " + args[i];
+            }
+            configureRules(rulesPath);
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+
+        CommandProcessor processor;
+        try {
+            processor.validateTournament(command);
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+
+        GameEngine engine;
+        engine.setBatchTournament(batch);
+        engine.setPhaseProfiling(profile);
+        engine.setOrderBudget(static_cast<std::size_t>(orderBudget));
+        engine.setDecisionTimeBudget(std::chrono::milliseconds(thinkMs));
+        if (progressSeconds == 0 && !statusPath.empty()) progressSeconds = DEFAULT_PROGRESS_SECONDS;
+        engine.setProgressReporting(std::chrono::seconds(progressSeconds), statusPath);
+        return engine.handleTournament(command) ? 0 : 1;
+    }
+
+    /** @brief validate-maps: index the directory and report every map; fails if any map is invalid */
+    int runValidateMaps(const vector<string>& args) {
+        MapIndex index(args.empty() ? string(MapIndex::DEFAULT_MAP_DIRECTORY) : args[0]);
+        try {
+            index.refresh();
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+
+        int invalid = 0;
+        for (const MapIndexEntry& e : index.getEntries()) {
+            cout << (e.valid ? "  valid    " : "  INVALID  ") << e.fileName << " ("
+                 << e.territoryCount << " territories, " << e.continentCount << " continents, "
+                 << e.edgeCount << " undirected edges)" << endl;
+            if (!e.valid) ++invalid;
+        }
+        cout << index.getEntries().size() << " maps, " << invalid << " invalid." << endl;
+        return invalid == 0 ? 0 : 1;
+    }
+
+    /** @brief pack-maps: pack the parsable maps of the directory into one archive next to it */
+    int runPackMaps(const vector<string>& args) {
+        MapIndex index(args.empty() ? string(MapIndex::DEFAULT_MAP_DIRECTORY) : args[0]);
+        try {
+            const int packed = MapArchive::pack(index);
+            MapArchive archive(index.getDirectory() + MapArchive::ARCHIVE_EXTENSION);
+            cout << "Packed " << packed << " of " << index.getEntries().size() << " maps: " << archive << endl;
+            return archive.isOpen() ? 0 : 1;
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+    }
+
+    /** @brief export-map: load a map and write it back as Conquest text, or as JSON for a .json output */
+    int runExportMap(const vector<string>& args) {
+        if (args.size() != 2) {
+            cerr << "export-map requires a map file and an output file" << endl;
+            return 1;
+        }
+        try {
+            Map map;
+            MapLoader loader;
+            loader.loadMap(args[0], map);
+            std::ofstream out(args[1], std::ios::binary | std::ios::trunc);
+            if (!out) throw std::runtime_error("Cannot open " + args[1]);
+
+            const string& output = args[1];
+            const bool json = output.size() >= 5 && output.compare(output.size() - 5, 5, ".json") == 0;
+            if (json) MapWriter::writeJson(map, out);
+            else MapWriter::writeConquest(map, out, std::filesystem::path(args[0]).stem().string());
+            out.close();
+            if (!out) throw std::runtime_error("Cannot write " + output);
+            cout << "Wrote " << map.getTerritories().size() << " territories and " << map.getContinents().size()
+                 << " continents to " << output << (json ? " (JSON)" : " (Conquest)") << endl;
+            return 0;
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+    }
+
+    /** @brief Write the game of an engine as JSON to path (nothing if path is empty) */
+    void writeStateJson(const GameEngine& engine, const string& path) {
+        if (path.empty()) return;
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out || !engine.writeStateJson(out)) throw std::runtime_error("Cannot write the game state to " + path);
+    }
+
+    /**
+     * @brief play -file: run the startup commands from a file, then play the game to the end
+     * @details With -state, every phase is committed to a memory-mapped state file for `resume`.
+     */
+    int runPlay(const vector<string>& args) {
+        string fileName;
+        string statePath;
+        string jsonPath;
+        int maxTurns = DEFAULT_PLAY_TURNS;
+        bool coalesce = false;
+        bool renumber = false;
+        bool profile = false;
+        int orderBudget = 0;
+        int thinkMs = 0;
+        string rulesPath;
+        try {
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                if (args[i] == "-file" && i + 1 < args.size()) fileName = args[++i];
+                else if (args[i] == "-state" && i + 1 < args.size()) statePath = args[++i];
+                else if (args[i] == "-json" && i + 1 < args.size()) jsonPath = args[++i];
+                else if (args[i] == "-D") maxTurns = positiveOption(args, i);
+                else if (args[i] == "-coalesce") coalesce = true;
+                else if (args[i] == "-renumber") renumber = true;
+                else if (args[i] == "-profile") profile = true;
+                else if (args[i] == "-orders") orderBudget = positiveOption(args, i);
+                else if (args[i] == "-think") thinkMs = positiveOption(args, i);
+                else if (args[i] == "-rules") rulesPath = stringOption(args, i);
+                else throw std::invalid_argument("Unknown argument: " + args[i]);
+            }
+            if (fileName.empty()) throw std::invalid_argument("play requires -file <commands.txt>");
+            configureRules(rulesPath);
+            cout << "Rules: " << activeRuleSet() << endl;
+
+            GameEngine engine;
+            engine.setOrderCoalescing(coalesce);
+            engine.setTerritoryRenumbering(renumber);
+            engine.setPhaseProfiling(profile);
+            engine.setOrderBudget(static_cast<std::size_t>(orderBudget));
+            engine.setDecisionTimeBudget(std::chrono::milliseconds(thinkMs));
+            FileCommandProcessorAdapter processor(fileName);
+            engine.startupPhase(engine, processor);
+
+            if (engine.getCurrentState() != GameState::Gamestart) {
+                cerr << "The command file did not start a game (no successful 'gamestart')." << endl;
+                return 1;
+            }
+            GameStateFile stateFile(statePath);
+            if (!statePath.empty()) engine.setStateFile(&stateFile);
+            const string winner = engine.runGameWithTurnLimit(maxTurns);
+            cout << "\nWinner: " << winner << endl;
+            writeStateJson(engine, jsonPath);
+            return 0;
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+    }
+
+    /** @brief resume: continue the game recorded by `play -state` from its last committed phase */
+    int runResume(const vector<string>& args) {
+        string statePath;
+        string jsonPath;
+        int maxTurns = DEFAULT_PLAY_TURNS;
+        bool renumber = false;
+        bool profile = false;
+        int orderBudget = 0;
+        int thinkMs = 0;
+        string rulesPath;
+        try {
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                if (args[i] == "-D") maxTurns = positiveOption(args, i);
+                else if (args[i] == "-json" && i + 1 < args.size()) jsonPath = args[++i];
+                else if (args[i] == "-renumber") renumber = true;
+                else if (args[i] == "-profile") profile = true;
+                else if (args[i] == "-orders") orderBudget = positiveOption(args, i);
+                else if (args[i] == "-think") thinkMs = positiveOption(args, i);
+                else if (args[i] == "-rules") rulesPath = stringOption(args, i);
+                else if (statePath.empty()) statePath = args[i];
+                else throw std::invalid_argument("Unknown argument: " + args[i]);
+            }
+            if (statePath.empty()) throw std::invalid_argument("resume requires a state file");
+            configureRules(rulesPath);
+            cout << "Rules: " << activeRuleSet() << endl;
+
+            GameEngine engine;
+            engine.setTerritoryRenumbering(renumber);
+            engine.setPhaseProfiling(profile);
+            engine.setOrderBudget(static_cast<std::size_t>(orderBudget));
+            engine.setDecisionTimeBudget(std::chrono::milliseconds(thinkMs));
+            GameStateFile stateFile(statePath);
+            const string winner = engine.resumeGame(stateFile, maxTurns);
+            cout << "\nWinner: " << winner << endl;
+            writeStateJson(engine, jsonPath);
+            return 0;
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+    }
+
+    /**
+     * @brief bench: time map loading/validation, bot games in the engine (output silenced) and
+     *        the same bots in a lockstep BatchSimulation of K games
+     */
+    int runBench(const vector<string>& args) {
+        vector<string> maps;
+        int games = DEFAULT_BENCH_GAMES;
+        int turns = DEFAULT_BENCH_TURNS;
+        int lanes = DEFAULT_BENCH_LANES;
+        bool coalesce = false;
+        bool renumber = false;
+        bool profile = false;
+        int orderBudget = 0;
+        int thinkMs = 0;
+        string rulesPath;
+        try {
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                if (args[i] == "-M") {
+                    while (i + 1 < args.size() && args[i + 1][0] != '-') maps.push_back(args[++i]);
+                } else if (args[i] == "-G") games = positiveOption(args, i);
+                else if (args[i] == "-D") turns = positiveOption(args, i);
+                else if (args[i] == "-K") lanes = positiveOption(args, i);
+                else if (args[i] == "-coalesce") coalesce = true;
+                else if (args[i] == "-renumber") renumber = true;
+                else if (args[i] == "-profile") profile = true;
+                else if (args[i] == "-orders") orderBudget = positiveOption(args, i);
+                else if (args[i] == "-think") thinkMs = positiveOption(args, i);
+                else if (args[i] == "-rules") rulesPath = stringOption(args, i);
+                else throw std::invalid_argument("Unknown argument: " + args[i]);
+            }
+            configureRules(rulesPath);
+        } catch (const std::exception& e) {
+            cerr << "ERROR: " << e.what() << endl;
+            return 1;
+        }
+
+        cout << "Rules: " << activeRuleSet() << endl;
+        if (!benchBattles()) return 1;
+        benchLargeLocality();
+
+        MapIndex& index = MapIndex::forDefaultDirectory();
+        BenchClock::time_point start = BenchClock::now();
+        const vector<MapIndexEntry>& entries = index.getEntries();
+        cout << "Map index: " << entries.size() << " maps in " << millisecondsSince(start) << " ms" << endl;
+        if (maps.empty()) {
+            for (const MapIndexEntry& e : entries) {
+                if (e.valid) maps.push_back(e.fileName);
+            }
+        }
+
+        const vector<string> strategies = {"Aggressive", "Benevolent"};
+        for (const string& mapName : maps) {
+            const MapIndexEntry* entry = index.find(mapName);
+            if (!entry || !entry->valid) {
+                cerr << "  skipping " << mapName << " (missing or invalid)" << endl;
+                continue;
+            }
+
+            const string path = index.getDirectory() + "/" + mapName;
+            MapLoader loader;
+            start = BenchClock::now();
+            for (int i = 0; i < BENCH_MAP_LOADS; ++i) {
+                Map map;
+                loader.loadMap(path, map);
+                map.validate();
+            }
+            const double loadMs = millisecondsSince(start) / BENCH_MAP_LOADS;
+
+            Map batchMap;
+            loader.loadMap(path, batchMap);
+            start = BenchClock::now();
+            BatchSimulation batch(batchMap, strategies, lanes, std::random_device{}());
+            int batchDecided = 0;
+            for (const string& result : batch.run(turns)) {
+                if (result != "Draw") ++batchDecided;
+            }
+            const double batchMs = millisecondsSince(start) / lanes;
+
+            int decided = 0;
+            start = BenchClock::now();
+            PhaseProfile phases;
+            OrderBudgetStats budgetStats;
+            {
+                QuietCout quiet;
+                GameEngine engine;
+                engine.setOrderCoalescing(coalesce);
+                engine.setTerritoryRenumbering(renumber);
+                engine.setPhaseProfiling(profile);
+                engine.setOrderBudget(static_cast<std::size_t>(orderBudget));
+                engine.setDecisionTimeBudget(std::chrono::milliseconds(thinkMs));
+                for (int g = 0; g < games; ++g) {
+                    if (engine.runSingleTournamentGame(mapName, strategies, turns) != "Draw") ++decided;
+                }
+                phases = engine.getPhaseProfile();
+                budgetStats = engine.getOrderBudgetStats();
+            }
+            const double gameMs = millisecondsSince(start) / games;
+
+            cout << "  " << mapName << ": load+validate " << loadMs << " ms, game ("
+                 << turns << " turns max) " << gameMs << " ms, " << decided << "/" << games
+                 << " decided" << endl;
+            cout << "      batch of " << lanes << ": " << batchMs << " ms per game, " << batchDecided
+                 << "/" << lanes << " decided" << endl;
+            benchLocality(loader, path);
+            benchWriters(loader, path);
+            if (profile) cout << "      phases of the " << games << " games:\n" << phases;
+            if (orderBudget > 0) cout << "      order budget " << orderBudget << ": " << budgetStats << endl;
+        }
+        return 0;
+    }
+
+    /** @brief replay: re-run the commands recorded in a game log against a fresh engine */
+    int runReplay(const vector<string>& args) {
+        const string logPath = args.empty() ? string("gamelog.txt") : args[0];
+        std::ifstream log(logPath);
+        if (!log) {
+            cerr << "ERROR: Cannot open " << logPath << endl;
+            return 1;
+        }
+
+        // Commands are logged as "Command: <command> | Effect: <effect>"
+        const string prefix = "Command: ";
+        const string separator = " | Effect:";
+        vector<string> commands;
+        string line;
+        while (std::getline(log, line)) {
+            if (line.compare(0, prefix.size(), prefix) != 0) continue;
+            const std::size_t end = line.find(separator);
+            commands.push_back(line.substr(prefix.size(), end == string::npos ? string::npos : end - prefix.size()));
+        }
+        if (commands.empty()) {
+            cerr << "No commands found in " << logPath << endl;
+            return 1;
+        }
+
+        GameEngine engine; // no LogObserver attached: replaying must not overwrite the log being read
+        for (const string& commandText : commands) {
+            cout << "\nReplaying: " << commandText << endl;
+            Command command(commandText);
+            try {
+                engine.processCommand(command);
+            } catch (const std::exception& e) {
+                cout << "  ERROR: " << e.what() << endl;
+            }
+        }
+        cout << "\nReplayed " << commands.size() << " command(s). Final state: " << engine.getStateName() << endl;
+        return 0;
+    }
+}
+
+/**
+ * @brief Run the subcommand named by argv[1], if any
+ * @param argc Argument count from main
+ * @param argv Arguments from main
+ * @return Exit status of the subcommand, or -1 if argv[1] is not a subcommand (run the demo drivers)
+ */
+int runCommandLine(int argc, char* argv[]) {
+    if (argc < 2) return -1;
+
+    const string mode = argv[1];
+    const vector<string> args(argv + 2, argv + argc);
+
+    if (mode == "tournament") return runTournament(args);
+    if (mode == "validate-maps") return runValidateMaps(args);
+    if (mode == "pack-maps") return runPackMaps(args);
+    if (mode == "export-map") return runExportMap(args);
+    if (mode == "play") return runPlay(args);
+    if (mode == "resume") return runResume(args);
+    if (mode == "bench") return runBench(args);
+    if (mode == "replay") return runReplay(args);
+    if (mode == "help" || mode == "--help" || mode == "-h") {
+        printUsage();
+        return 0;
+    }
+    return -1;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file GameStateFileDriver.cpp
+ * @brief Driver for the memory-mapped game state file (crash recovery)
+ *
+ * @details Commits a game with a Neutral territory to a GameStateFile, attaches a second
+ *          GameStateFile to the same file as a restarted process would, restores the game onto a
+ *          freshly loaded map and compares both boards and random engines.
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../include/GameStateFile.h"
+#include "../include/GameContext.h"
+#include "../include/Map.h"
+#include "../include/Orders.h"
+#include "../include/Player.h"
+
+// Importing only the neccessary std functions.
+using std::cout;
+using std::string;
+using std::vector;
+
+namespace {
+    const char* const DEMO_STATE_PATH = "demo.state";
+    const char* const DEMO_MAP = "assets/maps/World.map";
+
+    /** @brief Owner name of a territory as shown by the demo */
+    string ownerName(const Territory* territory) {
+        return territory->getOwner() ? territory->getOwner()->getPlayerName() : string("<none>");
+    }
+}
+
+/**
+ * @brief Demonstrates commit, attach and restore of a GameStateFile
+ * @details
+ *  - deals World.map between two players and blockades one territory (owned by Neutral),
+ *  - creates the state file and commits turn 1,
+ *  - attaches to the file from a second object, restores onto a new map and new players,
+ *  - compares owners and armies of every territory and the next random number of both games.
+ */
+void testGameStateFile() {
+    cout << "\n=== testGameStateFile ===\n";
+
+    // ======================= Original game =======================
+    Map map;
+    MapLoader loader;
+    loader.loadMap(DEMO_MAP, map);
+
+    GameContext game(2025);
+    Player alice("Alice"), bob("Bob");
+    alice.setGameContext(&game);
+    bob.setGameContext(&game);
+    alice.setReinforcementPool(7);
+    bob.setReinforcementPool(4);
+
+    const vector<Territory*> territories = map.getTerritoriesInFileOrder();
+    for (std::size_t i = 0; i < territories.size(); ++i) {
+        (i % 2 == 0 ? alice : bob).addPlayerTerritory(territories[i]);
+        territories[i]->setArmies(static_cast<ArmyCount>(i % 7 + 1));
+    }
+
+    BlockadeOrder blockade(&bob, territories[1]);
+    blockade.execute();
+    cout << "Blockade: " << blockade.effect() << "\n";
+
+    // ======================= Commit =======================
+    vector<Player*> players = {&alice, &bob};
+    {
+        GameStateFile file(DEMO_STATE_PATH);
+        if (!file.create("World.map", map, players, game)) {
+            cout << "Cannot create " << DEMO_STATE_PATH << "; skipping the demo.\n";
+            return;
+        }
+        file.commit(1, CommittedPhase::TurnEnded, map, players, game);
+        cout << "Committed: " << file << "\n";
+    }
+
+    // ======================= Attach and restore (as after a crash) =======================
+    GameStateFile resumed(DEMO_STATE_PATH);
+    if (!resumed.attach()) {
+        cout << "No committed state in " << DEMO_STATE_PATH << "\n";
+        std::remove(DEMO_STATE_PATH);
+        return;
+    }
+    cout << "Attached:  " << resumed << "\n";
+
+    Map restoredMap;
+    loader.loadMap(DEMO_MAP, restoredMap);
+    GameContext restoredGame(0); // seed irrelevant: the random engine comes from the file
+    vector<Player*> restoredPlayers;
+    for (std::size_t slot = 0; slot < resumed.getSlotCount(); ++slot) {
+        Player* player = new Player(resumed.getPlayerName(slot));
+        player->setGameContext(&restoredGame);
+        restoredPlayers.push_back(player);
+    }
+    resumed.restore(restoredMap, restoredPlayers, restoredGame);
+
+    // ======================= Compare =======================
+    const vector<Territory*> restored = restoredMap.getTerritoriesInFileOrder();
+    std::size_t differences = 0;
+    std::size_t neutral = 0;
+    for (std::size_t i = 0; i < territories.size(); ++i) {
+        if (ownerName(territories[i]) != ownerName(restored[i]) || territories[i]->getArmies() != restored[i]->getArmies()) {
+            ++differences;
+        }
+        if (restoredGame.hasNeutralPlayer() && restored[i]->getOwner() == restoredGame.getNeutralPlayerIfCreated()) ++neutral;
+    }
+    cout << "Restored " << restored.size() << " territories: " << differences << " differ, "
+         << neutral << " owned by Neutral (" << restored[1]->getName() << ": "
+         << restored[1]->getArmies() << " armies)\n";
+    cout << "Pools: Alice " << restoredPlayers[0]->getReinforcementPool() << ", Bob "
+         << restoredPlayers[1]->getReinforcementPool() << "\n";
+    cout << "Next random number " << (game.getRandom()() == restoredGame.getRandom()() ? "matches" : "differs")
+         << " between the original and the restored game\n";
+
+    for (Player* player : restoredPlayers) delete player;
+    std::remove(DEMO_STATE_PATH);
+}
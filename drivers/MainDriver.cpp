@@ -7,6 +7,8 @@
  *          - OrdersList operations and Order execution
  *          - Cards system with deck, hand, and playing mechanics
  *          - GameEngine state transitions and command processing
+ *          - Game state file, map writers, order coalescing, opening book, army counts
+ *            and the order validation cache
  *          
  *          Each test driver validates requirements for their respective components,
  *          ensuring system testing and demonstration of functionality.
@@ -35,6 +37,13 @@ void testLoggingObserver();
 void testMainGameLoop();
 void testPlayerStrategies();
 void testTournament();
+void testGameStateFile();
+void testMapWriter();
+void testOrderCoalescing();
+void testOpeningBook();
+void testArmyCount();
+void testValidationCache();
+int runCommandLine(int argc, char* argv[]);
 
 /**
  * @brief Main entry point for Warzone component testing
@@ -44,9 +53,16 @@ void testTournament();
  *          3. Orders system testing (creation, execution, list management)
  *          4. Cards system testing (deck, drawing, playing, Order generation)
  *          5. GameEngine testing (state transitions, command processing)
- * @return 0 on successful test completion
+ *          A subcommand as first argument (tournament, validate-maps, play, bench, replay)
+ *          runs only that mode instead; see CommandLineDriver.cpp.
+ * @return 0 on successful test completion, or the exit status of the subcommand
  */
 int main(int argc, char* argv[]) {
+    const int status = runCommandLine(argc, argv);
+    if (status >= 0) {
+        return status;
+    }
+
     std::cout << "=== Starting Warzone Test Drivers ===\n\n";
 
     testPlayerStrategies(); // A3, Part 1: Test player strategies (Aggressive, Neutral, etc.)
@@ -61,6 +77,12 @@ int main(int argc, char* argv[]) {
     testStartupPhase(argc, argv); // A2, Part 2: Test the implementation of commands entered.
     testLoggingObserver(); // Test Part 5: Observer pattern for logging
     testTournament(); // A3, Part 2: Test the game in Tournament Mode.
+    testGameStateFile(); // Commit, attach and restore a game through the memory-mapped state file
+    testMapWriter(); // Conquest round trip and JSON output of a map
+    testOrderCoalescing(); // Merging of repeated Deploys and Advances before execution
+    testOpeningBook(); // Record an opening and hit it on the next lookup
+    testArmyCount(); // Saturating army counts and repeated Blockade doubling
+    testValidationCache(); // Cached validate() results and their invalidation
 
     std::cout << "\n";
     std::cout << "\n=== Program finished successfully ===\n";
@@ -0,0 +1,81 @@
+/**
+ * @file MapWriterDriver.cpp
+ * @brief Driver for the Conquest and JSON map writers
+ *
+ * @details Writes World.map back as Conquest text, parses the text again and compares the two
+ *          maps (metadata, continents, territories with coordinates, continent and neighbours),
+ *          then shows the size of the JSON form.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/Map.h"
+#include "../include/MapWriter.h"
+
+// Importing only the neccessary std functions.
+using std::cout;
+using std::string;
+using std::vector;
+
+namespace {
+    const char* const DEMO_MAP = "assets/maps/World.map";
+    const char* const DEMO_COPY = "demo_roundtrip.map";
+
+    /** @brief One line per territory: name, coordinates, continent and neighbour names */
+    string describeTerritories(const Map& map) {
+        std::ostringstream out;
+        for (const Territory* t : map.getTerritoriesInFileOrder()) {
+            out << t->getName() << " (" << t->getX() << "," << t->getY() << ") "
+                << (t->getContinents().empty() ? string("-") : t->getContinents().front()->getName());
+            for (const Territory* adjacent : t->getAdjacents()) out << "|" << adjacent->getName();
+            out << "\n";
+        }
+        return out.str();
+    }
+}
+
+/**
+ * @brief Demonstrates a Conquest round trip and the JSON writer
+ * @details
+ *  - loads World.map and writes it with MapWriter::writeConquest() to a file,
+ *  - parses that file with MapLoader and compares metadata, continents and territories,
+ *  - writes the original map as JSON and shows its first characters.
+ */
+void testMapWriter() {
+    cout << "\n=== testMapWriter ===\n";
+
+    Map original;
+    MapLoader loader;
+    loader.loadMap(DEMO_MAP, original);
+
+    // ======================= Conquest round trip =======================
+    {
+        std::ofstream out(DEMO_COPY, std::ios::binary | std::ios::trunc);
+        MapWriter::writeConquest(original, out, "World");
+    }
+    Map copy;
+    loader.parseMapFile(DEMO_COPY, copy);
+    std::remove(DEMO_COPY);
+
+    bool sameContinents = original.getContinents().size() == copy.getContinents().size();
+    for (std::size_t i = 0; sameContinents && i < original.getContinents().size(); ++i) {
+        sameContinents = original.getContinents()[i]->getName() == copy.getContinents()[i]->getName()
+                      && original.getContinents()[i]->getBonus() == copy.getContinents()[i]->getBonus();
+    }
+    cout << "[Map] lines kept:   " << (original.getMetadata() == copy.getMetadata() ? "yes" : "no")
+         << " (" << copy.getMetadata().size() << " lines)\n";
+    cout << "Continents kept:    " << (sameContinents ? "yes" : "no") << " (" << copy.getContinents().size() << ")\n";
+    cout << "Territories kept:   " << (describeTerritories(original) == describeTerritories(copy) ? "yes" : "no")
+         << " (" << copy.getTerritories().size() << ", with coordinates and neighbours)\n";
+    const Territory* first = copy.getTerritoriesInFileOrder().front();
+    cout << "First territory:    " << first->getName() << " at (" << first->getX() << "," << first->getY() << ")\n";
+
+    // ======================= JSON =======================
+    std::ostringstream json;
+    MapWriter::writeJson(original, json);
+    cout << "JSON: " << json.str().size() << " bytes, starting " << json.str().substr(0, 72) << "...\n";
+}
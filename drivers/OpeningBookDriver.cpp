@@ -0,0 +1,70 @@
+/**
+ * @file OpeningBookDriver.cpp
+ * @brief Driver for the opening book of early-turn bot decisions
+ *
+ * @details Looks up a World.map opening position in an in-memory book (a miss), records the orders
+ *          played there, and looks the same position up again (a hit).
+ */
+
+#include <iostream>
+#include <vector>
+#include "../include/OpeningBook.h"
+#include "../include/Map.h"
+#include "../include/Player.h"
+
+// Importing only the neccessary std functions.
+using std::cout;
+using std::vector;
+
+/**
+ * @brief Demonstrates record and lookup in the OpeningBook
+ * @details The key is built from the map hash and the position hash of a player, as the engine
+ *          does at the start of an issue phase; the turn order does not change the position.
+ */
+void testOpeningBook() {
+    cout << "\n=== testOpeningBook ===\n";
+
+    Map map;
+    MapLoader loader;
+    loader.loadMap("assets/maps/World.map", map);
+
+    Player alice("Alice"), bob("Bob");
+    const vector<Territory*> territories = map.getTerritoriesInFileOrder();
+    for (std::size_t i = 0; i < territories.size(); ++i) {
+        (i % 2 == 0 ? alice : bob).addPlayerTerritory(territories[i]);
+        territories[i]->setArmies(1);
+    }
+    const vector<Player*> players = {&alice, &bob};
+
+    OpeningBookKey key;
+    key.mapHash = OpeningBook::hashMap(map);
+    key.playerCount = static_cast<int>(players.size());
+    key.turn = 1;
+    key.positionHash = OpeningBook::hashPosition(map, players, &alice, "Aggressive");
+
+    OpeningBook book; // in memory: nothing is saved
+    cout << "First lookup:  " << (book.lookup(key) ? "hit" : "miss") << "\n";
+
+    OpeningBookMove deploy;
+    deploy.type = OpeningBookMove::Type::Deploy;
+    deploy.targetId = territories[0]->getId();
+    deploy.amount = 50;
+    OpeningBookMove advance;
+    advance.type = OpeningBookMove::Type::Advance;
+    advance.sourceId = territories[0]->getId();
+    advance.targetId = territories[1]->getId();
+    advance.amount = 50;
+    book.record(key, {deploy, advance});
+
+    const vector<OpeningBookMove>* moves = book.lookup(key);
+    cout << "Second lookup: " << (moves ? "hit" : "miss") << " (" << (moves ? moves->size() : 0) << " moves)\n";
+
+    const vector<Player*> shuffled = {&bob, &alice}; // another game: same deal, other turn order
+    key.positionHash = OpeningBook::hashPosition(map, shuffled, &alice, "Aggressive");
+    cout << "Turn order swapped: " << (book.lookup(key) ? "hit" : "miss") << "\n";
+
+    territories[0]->setArmies(5); // another position: the book does not apply
+    key.positionHash = OpeningBook::hashPosition(map, players, &alice, "Aggressive");
+    cout << "Other position: " << (book.lookup(key) ? "hit" : "miss") << "\n";
+    cout << book << "\n";
+}
@@ -0,0 +1,84 @@
+/**
+ * @file OrderCoalescingDriver.cpp
+ * @brief Driver for the order coalescing pass
+ *
+ * @details Issues repeated Deploys and Advances for one player and shows the orders list before
+ *          and after OrderCoalescing::coalesceDeploys() and coalesceAdvances().
+ */
+
+#include <iostream>
+#include <vector>
+#include "../include/OrderCoalescing.h"
+#include "../include/GameContext.h"
+#include "../include/Map.h"
+#include "../include/Orders.h"
+#include "../include/Player.h"
+
+// Importing only the neccessary std functions.
+using std::cout;
+using std::vector;
+
+namespace {
+    /** @brief Orders of a list that will execute (not coalesced) */
+    std::size_t activeOrders(const OrdersList& list) {
+        std::size_t active = 0;
+        for (const Order* order : list.getOrders()) {
+            if (!order->isCoalesced()) ++active;
+        }
+        return active;
+    }
+}
+
+/**
+ * @brief Demonstrates the Deploy and Advance merging of OrderCoalescing
+ * @details Alice deploys twice to Territory-1 and once to Territory-2, then advances twice from
+ *          Territory-3 into Bob's Territory-4: the two Deploys to Territory-1 become one order
+ *          and the second Advance is marked coalesced into the first.
+ */
+void testOrderCoalescing() {
+    cout << "\n=== testOrderCoalescing ===\n";
+
+    Player alice("Alice"), bob("Bob");
+    GameContext game;
+    alice.setGameContext(&game);
+    bob.setGameContext(&game);
+    alice.setReinforcementPool(10);
+
+    Map m;
+    Territory* t1 = new Territory(1, "Territory-1");
+    Territory* t2 = new Territory(2, "Territory-2");
+    Territory* t3 = new Territory(3, "Territory-3");
+    Territory* t4 = new Territory(4, "Territory-4");
+    t3->addAdjacent(t4);
+    t4->addAdjacent(t3);
+    m.addTerritory(t1);
+    m.addTerritory(t2);
+    m.addTerritory(t3);
+    m.addTerritory(t4);
+
+    alice.addPlayerTerritory(t1);
+    alice.addPlayerTerritory(t2);
+    alice.addPlayerTerritory(t3);
+    bob.addPlayerTerritory(t4);
+    t1->setArmies(2);
+    t2->setArmies(2);
+    t3->setArmies(12);
+    t4->setArmies(3);
+
+    OrdersList* orders = alice.getOrdersList();
+    orders->add(new DeployOrder(&alice, t1, 3));
+    orders->add(new DeployOrder(&alice, t1, 2));
+    orders->add(new DeployOrder(&alice, t2, 1));
+    orders->add(new AdvanceOrder(&alice, t3, t4, 4));
+    orders->add(new AdvanceOrder(&alice, t3, t4, 5));
+    cout << "Before: " << orders->size() << " orders\n" << *orders;
+
+    const vector<Player*> players = {&alice, &bob};
+    const int removed = OrderCoalescing::coalesceDeploys(players);
+    cout << "coalesceDeploys(): " << removed << " Deploy removed, " << orders->size() << " orders left\n";
+
+    const int marked = OrderCoalescing::coalesceAdvances(players);
+    cout << "coalesceAdvances(): " << marked << " Advance marked coalesced, " << activeOrders(*orders)
+         << " of " << orders->size() << " orders will execute\n";
+    cout << "After:\n" << *orders;
+}
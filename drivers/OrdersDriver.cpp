@@ -10,10 +10,12 @@
  * proper polymorphic behavior of different order types.
  */
 
+#include <cstdint>
 #include <iostream>
 #include "../include/Orders.h"
 #include "../include/Player.h"
 #include "../include/Map.h"
+#include "../include/GameContext.h"
 
 // Importing only the neccessary std functions.
 using std::cout;
@@ -38,8 +40,10 @@ void testOrdersLists() {
     alice.setReinforcementPool(20);  // or whatever your method is
     bob.setReinforcementPool(20); 
     
-    // Initialize global neutral player for Blockade orders
-    neutralPlayer = new Player("Neutral");
+    // Game of both players: its Neutral player receives blockaded territories
+    GameContext game;
+    alice.setGameContext(&game);
+    bob.setGameContext(&game);
     
     OrdersList ol;
     
@@ -119,10 +123,6 @@ void testOrdersLists() {
     t1->setOwner(nullptr);
     t2->setOwner(nullptr);
     t3->setOwner(nullptr);
-    
-    // Clean up global neutral player
-    delete neutralPlayer;
-    neutralPlayer = nullptr;
 
     cout << "=== end testOrdersLists ===\n";
 }
@@ -135,7 +135,9 @@ void testOrderExecution() {
     alice.setReinforcementPool(20);  // or whatever your method is
     bob.setReinforcementPool(20);
 
-    neutralPlayer = new Player("Neutral"); 
+    GameContext game; // owns the Neutral player that receives the blockaded territory
+    alice.setGameContext(&game);
+    bob.setGameContext(&game);
 
     Map m;
     Territory* t1 = new Territory(1, "Territory-1");
@@ -211,3 +213,42 @@ void testOrderExecution() {
     std::cout << "=== end testOrderExecution ===\n";
 }
 
+
+/**
+ * @brief Demonstrates the validation cache of orders
+ * @details A Deploy validated twice in a row reuses its result; a change of the issuer's pool
+ *          (player version bump) and setAmount() both invalidate it, so the next validate()
+ *          decides again on the current state.
+ */
+void testValidationCache() {
+    std::cout << "\n=== testValidationCache ===\n";
+
+    Player alice("Alice");
+    alice.setReinforcementPool(5);
+    Map m;
+    Territory* t1 = new Territory(1, "Territory-1");
+    m.addTerritory(t1);
+    alice.addPlayerTerritory(t1);
+
+    // ValidationCache on its own: a result holds while the versions it was recorded with are current
+    ValidationCache cache;
+    cache.record({alice.getVersion(), t1->getVersion()}, true);
+    std::cout << "Recorded with the current versions: current = "
+              << cache.isCurrent({alice.getVersion(), t1->getVersion()}) << "\n";
+
+    DeployOrder deploy(&alice, t1, 4);
+    std::cout << "Deploy 4 with a pool of 5: valid = " << deploy.validate()
+              << ", again (cached) = " << deploy.validate() << "\n";
+
+    const std::uint64_t before = alice.getVersion();
+    alice.setReinforcementPool(3); // bumps Alice's version
+    std::cout << "Pool set to 3 (version " << before << " -> " << alice.getVersion() << "): cache current = "
+              << cache.isCurrent({alice.getVersion(), t1->getVersion()})
+              << ", deploy valid = " << deploy.validate() << "\n";
+
+    deploy.setAmount(2); // drops the recorded result
+    std::cout << "setAmount(2): deploy valid = " << deploy.validate() << "\n";
+
+    t1->setOwner(nullptr);
+    std::cout << "Territory-1 lost (version " << t1->getVersion() << "): deploy valid = " << deploy.validate() << "\n";
+}
@@ -0,0 +1,54 @@
+/**
+ * @file ArmyCount.h
+ * @brief 64-bit army counts with saturating arithmetic.
+ *
+ * @details
+ *  Blockade doubles the armies of a territory every time it is played and the Neutral player
+ *  never spends them, so in long games army counts grow exponentially. An `int` overflows after
+ *  about thirty doublings; a territory now stores an ArmyCount and every change of it saturates:
+ *   - counts never go below 0 nor above Armies::MAX,
+ *   - Armies::MAX leaves room to add up the armies of 2^17 saturated territories (continent and
+ *     map totals) without overflowing the 64-bit type.
+ *  Battles between large stacks are resolved in a number of steps that does not grow with the
+ *  stack sizes (see GameRules::resolveBattleSeeded()).
+ *
+ * @note Reinforcement pools and Deploy amounts stay `int`: they come from the reinforcement
+ *       income, which grows with the number of territories, not with the armies.
+ */
+
+#pragma once
+#include <cstdint>
+#include <limits>
+
+using ArmyCount = std::int64_t;
+
+namespace Armies {
+    constexpr ArmyCount MAX = ArmyCount(1) << 45; ///< Saturation bound of one territory (about 3.5e13)
+
+    /** @brief value clamped to [0, MAX] */
+    constexpr ArmyCount clamp(ArmyCount value) {
+        return value < 0 ? 0 : (value > MAX ? MAX : value);
+    }
+
+    /** @brief a + b clamped to [0, MAX], for any a and b within [-MAX, MAX] and beyond */
+    constexpr ArmyCount add(ArmyCount a, ArmyCount b) {
+        if (b > 0 && a > std::numeric_limits<ArmyCount>::max() - b) return MAX;
+        if (b < 0 && a < std::numeric_limits<ArmyCount>::min() - b) return 0;
+        return clamp(a + b);
+    }
+
+    /** @brief a - b clamped to [0, MAX] */
+    constexpr ArmyCount subtract(ArmyCount a, ArmyCount b) {
+        return b == std::numeric_limits<ArmyCount>::min() ? MAX : add(a, -b);
+    }
+
+    /** @brief 2a clamped to [0, MAX] (Blockade) */
+    constexpr ArmyCount twice(ArmyCount a) { return add(a, a); }
+
+    /** @brief value clamped to the range of int, for int consumers (opening book moves) */
+    constexpr int toInt(ArmyCount value) {
+        return value > std::numeric_limits<int>::max() ? std::numeric_limits<int>::max()
+             : value < std::numeric_limits<int>::min() ? std::numeric_limits<int>::min()
+             : static_cast<int>(value);
+    }
+}
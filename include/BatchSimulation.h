@@ -0,0 +1,105 @@
+/**
+ * @file BatchSimulation.h
+ * @brief Lockstep simulation of many bot-only games on the same map.
+ *
+ * @details
+ *  A tournament plays many games on one map topology; only the owners and armies differ. The
+ *  BatchSimulation keeps the state of K games ("lanes") interleaved game-minor, i.e. the value of
+ *  territory `t` in game `g` is at `[t * K + g]`, and advances all K games one phase at a time.
+ *  Each kernel walks the topology once and, for every territory, runs a branch-free inner loop
+ *  over the K lanes: per-lane decisions (whose turn, which bot, is the game still running) are
+ *  masks, so the compiler can vectorize the inner loops.
+ *
+ *  Supported bots (simplified, no cards or diplomacy):
+ *   - Aggressive: deploys everything on its strongest territory, then attacks the weakest adjacent
+ *     enemy from every territory with more than one army.
+ *   - Benevolent: deploys everything on its weakest territory, never attacks.
+ *   - Neutral:    does nothing until attacked, then plays as Aggressive.
+ *   - Cheater:    conquers every adjacent enemy territory once per turn (1 army left on each).
+ *
+ *  Setup follows `gamestart`: territory t goes to player `t % players` in map order (strategies in
+ *  command order), then lane g shuffles the seats with a random engine seeded with `seed + g`,
+ *  like an engine game whose GameContext has that seed. The same engine then draws one seed per
+ *  battle, resolved by the engine's seeded resolver (GameRules::resolveBattleSeeded(),
+ *  BattleResolver.h); as in AdvanceOrder, the target is conquered whenever no defender survives.
+ *  Armies saturate at Armies::MAX as on the engine's board.
+ *
+ *  Rule differences with the GameEngine (`tournament -batch` prints them):
+ *   - no cards: conquests draw no card, so there is no Bomb, Blockade, Airlift or Negotiate,
+ *   - orders are resolved as soon as a seat issues them, not in the round-robin execute phase,
+ *   - attack sources are visited in territory order, each attacking with all but one army,
+ *   - no opening book, order budget or decision time budget.
+ *  Results are therefore statistically similar to the engine's but not identical.
+ *
+ * @note Battles, reinforcement and setup use the same rule kernels as the engine (GameRules.h).
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <random>
+#include <iosfwd>
+#include "ArmyCount.h"
+
+class Map;
+
+/**
+ * @brief K bot-only games on one map, simulated in lockstep.
+ */
+class BatchSimulation {
+public:
+    static const int MIN_PLAYERS = 2;
+    static const int MAX_PLAYERS = 4;
+
+    BatchSimulation(const Map& map, const std::vector<std::string>& strategies, int games, std::uint64_t seed);
+
+    static bool supports(const std::string& strategy); // true for the bots listed above
+
+    std::vector<std::string> run(int maxTurns); // winner strategy of every game, or "Draw"
+
+    int getGameCount() const;
+    int getTerritoryCount() const;
+    long getTurnsSimulated() const;
+
+    friend std::ostream& operator<<(std::ostream& os, const BatchSimulation& batch);
+
+private:
+    enum Bot : std::uint8_t { Aggressive, Benevolent, Neutral, Cheater };
+
+    // Topology shared by every lane (adjacency and continents in compressed rows)
+    int territoryCount;
+    int lanes;
+    std::vector<int> adjacencyOffsets;
+    std::vector<int> adjacency;
+    std::vector<int> continentOffsets;
+    std::vector<int> continentMembers;
+    std::vector<int> continentBonus;
+    std::vector<std::string> strategies; // strategy of each player index
+
+    // Lane state, game-minor
+    std::vector<std::int8_t> owner;   // [territory * lanes + game], player index or -1
+    std::vector<ArmyCount> armies;    // [territory * lanes + game]
+    std::vector<std::uint8_t> bot;    // [player * lanes + game], current behaviour (Neutral may turn Aggressive)
+    std::vector<int> reserve;         // [player * lanes + game], reinforcement pool
+    std::vector<std::int8_t> seating; // [seat * lanes + game], player index of each seat (shuffled)
+    std::vector<std::uint8_t> running; // [game], 1 while the game is undecided
+    std::vector<std::int8_t> winner;  // [game], player index or -1
+    std::vector<std::mt19937_64> rngs; // [game], seat shuffle and battle seeds as in a GameContext
+    long turnsSimulated;
+
+    // Per-lane scratch of the current seat
+    std::vector<int> me;
+    std::vector<std::uint8_t> acting;
+    std::vector<int> chosen;
+    std::vector<ArmyCount> chosenArmies;
+    std::vector<std::uint8_t> marked; // [territory * lanes + game]
+
+    void setup(std::uint64_t seed);
+    void selectSeat(int seat);
+    void reinforce();
+    void deploy();
+    void attack();
+    void cheat();
+    void updateWinners();
+};
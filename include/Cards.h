@@ -21,6 +21,7 @@ class Deck {
         void removeCard(Card* card);
         std::vector<Card*> getCardsOnDeck() const;
         std::string draw(Hand &hand);
+        std::string draw(Hand &hand, std::mt19937_64 &random); // Draw with the random engine of a game.
         void showDeck();
         ~Deck(); // Destructor for Card*.
     private:
@@ -0,0 +1,97 @@
+/**
+ * @file ContinentGraph.h
+ * @brief Continent-level abstraction of a Map for coarse strategic planning.
+ *
+ * @details
+ *  Nodes are the continents of a Map; an edge joins two continents that share at least one
+ *  territory border and lists the border territories on each side. Every node keeps aggregate
+ *  summaries (armies, and territories/armies held by each player) that are updated incrementally:
+ *  the graph listens to its territories (TerritoryListener), so a conquest or an army change costs
+ *  O(players on that continent) instead of a rescan of the map.
+ *
+ *  Planning queries run in O(continents) on the summaries:
+ *   - cheapestToComplete(): continent a player can finish with the least enemy resistance,
+ *   - underThreat(): continents held by a player that border enemy territories,
+ *   - path(): shortest chain of continents between two continents (BFS),
+ *   - continentBonus(): reinforcement bonus of every continent fully held by a player.
+ *  Strategies plan on continents, then refine on territories only where the plan points.
+ *
+ * @ownership
+ *  The graph observes, but does not own, the Map. It must be destroyed (or rebuilt) before the
+ *  territories of the Map are deleted, e.g. before the Map is reloaded.
+ */
+
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <iosfwd>
+#include "Map.h"
+
+class Player;
+
+/**
+ * @brief Territories and armies one player holds on a continent.
+ */
+struct ContinentHolding {
+    Player* player = nullptr;
+    int territories = 0;
+    ArmyCount armies = 0;
+};
+
+/**
+ * @brief Border between two continents.
+ */
+struct ContinentEdge {
+    int to = -1;                       ///< Index of the neighbouring continent node
+    std::vector<Territory*> borders;   ///< Territories of this continent adjacent to the neighbour
+    std::vector<Territory*> across;    ///< Territories of the neighbour adjacent to this continent
+};
+
+/**
+ * @brief Continent node with its incrementally maintained summary.
+ */
+struct ContinentNode {
+    Continent* continent = nullptr;
+    std::vector<Territory*> territories;
+    std::vector<ContinentEdge> edges;
+    ArmyCount armies = 0;                    ///< Armies on the whole continent
+    std::vector<ContinentHolding> holdings;  ///< One entry per player present (unowned territories excluded)
+
+    Player* soleOwner() const; // player holding every territory, or nullptr
+    const ContinentHolding* holdingOf(const Player* player) const;
+};
+
+/**
+ * @brief Coarse graph of continents kept in sync with the territories of a Map.
+ */
+class ContinentGraph : public TerritoryListener {
+public:
+    explicit ContinentGraph(Map& map);
+    ~ContinentGraph() override;
+
+    void rebuild(); // recompute every summary from the territories
+
+    const std::vector<ContinentNode>& getNodes() const;
+    int indexOf(const Continent* continent) const; // -1 if not in the graph
+    int continentOf(const Territory* territory) const; // node index, -1 if the territory has no continent
+
+    // Planning queries
+    int continentBonus(const Player* player) const;
+    Continent* cheapestToComplete(const Player* player) const;
+    std::vector<Continent*> underThreat(const Player* player) const;
+    std::vector<Continent*> path(const Continent* from, const Continent* to) const;
+
+    void territoryChanged(const Territory& territory, Player* previousOwner, ArmyCount previousArmies) override;
+
+    ContinentGraph(const ContinentGraph&) = delete;
+    ContinentGraph& operator=(const ContinentGraph&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const ContinentGraph& graph);
+
+private:
+    static void adjust(ContinentNode& node, Player* player, int territories, ArmyCount armies);
+
+    Map* map;
+    std::vector<ContinentNode> nodes;
+    std::unordered_map<const Continent*, int> continentIndex;
+    std::unordered_map<const Territory*, int> territoryContinent;
+};
@@ -0,0 +1,87 @@
+/**
+ * @file GameContext.h
+ * @brief Per-game state shared by the engine, the players and their orders.
+ *
+ * @details
+ *  A game used to reach part of its state through process globals: Blockade handed territories to
+ *  the global `neutralPlayer` (null in engine games, so every Blockade was invalid), battles and
+ *  card draws took their randomness from per-thread or `rand()` generators. A GameContext gathers
+ *  what belongs to one game:
+ *   - the Neutral player that receives blockaded territories, created on first use,
+ *   - the random engine of the game (player order, card draws, battle seeds), seeded once so a
+ *     context can be replayed from its seed,
+ *   - the deck of cards,
+ *   - the log observer attached to the orders of the game's players,
+ *   - the metrics of the game (phase profile and order budget backpressure).
+ *  The engine owns one context per game and hands it to its players (Player::setGameContext());
+ *  orders and strategies reach it through their player. Games with separate contexts share no
+ *  mutable state, so several of them can run concurrently in one process.
+ *
+ * @note The Neutral player is not one of the game's players: it never issues orders and is never
+ *       eliminated. A GameStateFile records its territories under a reserved owner slot, and the
+ *       random engine with every commit.
+ */
+
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+#include <random>
+#include "PerfCounters.h"
+
+class Player;
+class Deck;
+class Observer;
+
+/**
+ * @brief Backpressure applied by the per-player per-turn order budget (GameEngine::setOrderBudget())
+ */
+struct OrderBudgetStats {
+    std::size_t limitedTurns = 0;  ///< Player turns that used up their budget
+    std::size_t droppedOrders = 0; ///< Orders refused by OrdersList::add() over the budget
+
+    OrderBudgetStats& operator+=(const OrderBudgetStats& other);
+};
+std::ostream& operator<<(std::ostream& os, const OrderBudgetStats& stats);
+
+/**
+ * @class GameContext
+ * @brief Neutral player, randomness, deck, log and metrics of one game.
+ * @ownership Owns the Neutral player and the deck; the log observer is not owned.
+ */
+class GameContext {
+public:
+    GameContext(); // seeded from std::random_device
+    explicit GameContext(std::uint64_t seed);
+    GameContext(const GameContext& other); // copies everything but the Neutral player
+    ~GameContext();
+
+    GameContext& operator=(const GameContext& other);
+    friend std::ostream& operator<<(std::ostream& os, const GameContext& context);
+
+    Player* getNeutralPlayer(); // created on first use
+    bool hasNeutralPlayer() const;
+    const Player* getNeutralPlayerIfCreated() const; // nullptr before the first Blockade
+
+    std::mt19937_64& getRandom();
+    const std::mt19937_64& getRandom() const;
+    std::uint64_t getSeed() const;
+    std::uint64_t nextBattleSeed();
+
+    Deck& getDeck();
+    const Deck& getDeck() const;
+
+    void setLog(Observer* log); // attached to the orders of players added afterwards (may be null)
+    Observer* getLog() const;
+
+    PhaseProfile& getPhaseProfile();
+    OrderBudgetStats& getOrderBudgetStats();
+
+private:
+    Player* neutralPlayer; // Receives blockaded territories (owned, nullptr until needed)
+    std::uint64_t seed;
+    std::mt19937_64 random;
+    Deck* deck; // One deck of cards for the game (owned)
+    Observer* log; // Log of the game's orders (not owned, may be null)
+    PhaseProfile phaseProfile; // Counters of the measured phases
+    OrderBudgetStats orderBudgetStats; // Backpressure applied so far
+};
@@ -19,7 +19,10 @@
 #include <vector>
 #include <iostream>
 #include <utility>
+#include <chrono>
+#include <cstdint>
 #include "LoggingObserver.h"
+#include "GameContext.h"
 
 
 // Forward declarations
@@ -30,6 +33,14 @@ class Order;
 class Territory;
 class Deck;
 class CommandProcessor;
+class OpeningBook;
+class StrategyPool;
+class ContinentGraph;
+class GameStateFile;
+class TournamentProgress;
+enum class CommittedPhase : std::int32_t;
+struct OpeningBookMove;
+struct PreparedMap;
 
 /**
  * @brief Simple command object representing user input commands
@@ -155,6 +166,9 @@ public:
 
     // Getter for deck.
     Deck* getDeck();
+
+    // Neutral player, randomness, deck, log and metrics of the engine's game
+    GameContext& getGameContext();
     
     // Game state queries
     bool isValidCommand(const std::string& commandStr) const;
@@ -173,6 +187,39 @@ public:
     void reinforcementPhase();
     void issueOrdersPhase();
     void executeOrdersPhase();
+
+    // Per-player per-turn time budget for bot decisions in the issue phase (0 = unlimited)
+    void setDecisionTimeBudget(std::chrono::milliseconds budget);
+    std::chrono::milliseconds getDecisionTimeBudget() const;
+
+    // Merge same-target Deploys and same-pair Advances before executing them (off by default)
+    void setOrderCoalescing(bool enabled);
+    bool isOrderCoalescing() const;
+
+    // Renumber the territories of every loaded map for locality (Map::renumberForLocality(), off by default)
+    void setTerritoryRenumbering(bool enabled);
+    bool isTerritoryRenumbering() const;
+
+    // Measure the phases, map loading and validation with performance counters (off by default)
+    void setPhaseProfiling(bool enabled);
+    bool isPhaseProfiling() const;
+    const PhaseProfile& getPhaseProfile() const;
+
+    // Orders each player may issue per turn (0 = unlimited); players that reach it are not asked again
+    void setOrderBudget(std::size_t maxOrdersPerTurn);
+    std::size_t getOrderBudget() const;
+    const OrderBudgetStats& getOrderBudgetStats() const;
+
+    // Report tournament progress every interval (0 = off) to stderr, or into a status file
+    void setProgressReporting(std::chrono::milliseconds interval, const std::string& statusPath = "");
+    std::chrono::milliseconds getProgressInterval() const;
+    const std::string& getProgressPath() const;
+    const TournamentProgress* getTournamentProgress() const; // nullptr outside of a tournament
+
+    // Play bot-only tournaments in a lockstep BatchSimulation per map (simplified rules, see
+    // BatchSimulation.h; off by default)
+    void setBatchTournament(bool enabled);
+    bool isBatchTournament() const;
     
     // Utility methods for console interface
     void printCurrentState() const;
@@ -196,8 +243,18 @@ public:
     // ** CURRENTLY IN PUBLIC FOR TESTING (ROMAN's IMPLEMENTATION) **
     bool handleTournament(const std::string& command);
     std::string runSingleTournamentGame(const std::string& mapName, const std::vector<std::string>& stratNames,int maxTurns);
+    std::string runSingleTournamentGame(PreparedMap& prepared, const std::vector<std::string>& stratNames, int maxTurns);
     std::string runGameWithTurnLimit(int maxTurns);
 
+    // Crash recovery: record the next game in a memory-mapped state file (not owned, may be null),
+    // or resume the game recorded in one from its last committed phase
+    void setStateFile(GameStateFile* file);
+    std::string resumeGame(GameStateFile& file, int maxTurns);
+
+    // Board, players, state and turn (last played once the game is over) as streaming JSON
+    // (see MapWriter.h); false without a map
+    bool writeStateJson(std::ostream& out) const;
+
 private:
     // Type aliases for readability
     using GameStateCmdPair = std::pair<GameState, std::string>;
@@ -208,19 +265,44 @@ private:
 
     // Game data members
     Map* gameMap; // The current game map using pointer as required
+    ContinentGraph* continentGraph; // Continent summaries of gameMap, built on first use (owned, reset with the map)
     std::vector<Player*>* players; // List of players in the game using pointer as required
     MapLoader* mapLoader; // Map loader instance (pointer as required)
-    Deck* deck; // One deck of cards for each game.
+    GameContext* context; // Neutral player, randomness, deck, log and metrics of the game (owned)
+    OpeningBook* openingBook; // Opening book consulted during the first turns (not owned, may be null)
+    StrategyPool* strategyPool; // Pool supplying player strategies during a tournament (not owned, may be null)
+    GameStateFile* stateFile; // Phase commits of the running game for crash recovery (not owned, may be null)
+    std::string* loadedMapName; // Map file name of the last successful loadmap (pointer as required)
+    int* turnNumber; // Current turn of the running game loop (0 outside of a game)
+    int* lastTurn; // Last turn played to its end by the game loop, kept after the game
+    std::chrono::milliseconds* decisionTimeBudget; // Per-player per-turn decision time (pointer as required)
+    bool* orderCoalescing; // Run the OrderCoalescing passes in the execute phase (pointer as required)
+    bool* territoryRenumbering; // Renumber loaded maps for locality (pointer as required)
+    bool* phaseProfiling; // Measure phases with PerfScope (pointer as required)
+    std::size_t* orderBudget; // Orders per player per turn, 0 = unlimited (pointer as required)
+    std::chrono::milliseconds* progressInterval; // Tournament progress report period, 0 = off (pointer as required)
+    std::string* progressPath; // Status file of the progress reports, empty for stderr (pointer as required)
+    TournamentProgress* progress; // Counters of the running tournament (not owned, nullptr outside of one)
+    bool* batchTournament; // Play tournaments in a BatchSimulation (pointer as required)
     
     // Private helper methods
     void initializeTransitions();
     void transition(GameState newState);
+    ContinentGraph& getContinentGraph();
+    void resetContinentGraph();
+    PhaseProfile* profiling();
+    void attachToGame(Player* player);
+    void copyTournamentSettings(GameEngine& game) const;
+    std::string playTournamentGame(GameEngine& game, const std::vector<std::string>& playerStrats, int maxTurns);
+    bool playBatchTournament(const std::vector<std::string>& mapNames, const std::vector<std::string>& playerStrats,
+                             int numGames, int maxTurns, std::vector<std::vector<std::string>>& results);
     bool isValidTransition(GameState from, const std::string& command, GameState& to) const;
     void executeStateTransition(GameState newState, const std::string& command, std::string& effectMsg);
     
     // State-specific action methods (effectMsg captures success or error message)
     bool handleLoadMap(const std::string& command, std::string& effectMsg);
     bool handleValidateMap(std::string& effectMsg);
+    bool handlePreparedMap(PreparedMap& prepared, std::string& effectMsg);
     bool handleAddPlayer(const std::string& command, std::string& effectMsg);
     void handleAssignCountries(const std::string& command);
     void handleIssueOrder(const std::string& command);
@@ -230,6 +312,9 @@ private:
     // ------------ Part 3 helpers ------------
     void removeDefeatedPlayers();
     bool checkWinCondition(Player*& winner) const;
+    bool replayOpeningMoves(Player* player, const std::vector<OpeningBookMove>& moves);
+    std::string playTurns(int firstTurn, bool firstTurnReinforced, int maxTurns);
+    void commitState(int turn, CommittedPhase phase);
 
     // Helper methods for map loading validation
     bool extractMapFilename(const std::string& command, std::string& mapName, std::string& errorMsg) const;
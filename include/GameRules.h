@@ -0,0 +1,110 @@
+/**
+ * @file GameRules.h
+ * @brief Rule policies for battle, reinforcement and setup constants, and the kernels templated on them.
+ *
+ * @details
+ *  Every rule constant of the game lives in one policy type:
+ *   - StandardRules: the Warzone rules as `constexpr` functions. Kernels instantiated with it are
+ *     constant-folded, exactly as if the numbers were written inline.
+ *   - RuntimeRules:  the same interface backed by a mutable RuleSet, for rule-variant experiments.
+ *
+ *  The engine uses `ActiveRules`, which is StandardRules unless the build defines
+ *  `WARZONE_RUNTIME_RULES` (e.g. `-DWARZONE_RUNTIME_RULES`), so the default build pays nothing for
+ *  the configurable variant. A RuleSet is read from a file of `key=value` lines (RuleSet::load(),
+ *  the `-rules` option of the command line), one line per member to change.
+ *
+ * @note Kernels are templates and therefore defined in this header.
+ */
+
+#pragma once
+#include <algorithm>
+#include <iosfwd>
+#include <string>
+#include "ArmyCount.h"
+
+/**
+ * @brief Standard Warzone rules, known at compile time.
+ */
+struct StandardRules {
+    static constexpr double attackerKillProbability() { return 0.6; } // per attacking army and round
+    static constexpr double defenderKillProbability() { return 0.7; } // per defending army and round
+    static constexpr int reinforcementDivisor() { return 3; }  // one army per N territories
+    static constexpr int minimumReinforcement() { return 3; }  // floor of the territory-based income
+    static constexpr int startingArmies() { return 50; }       // initial reinforcement pool
+    static constexpr int cardsPerType() { return 10; }         // copies of each card type in the deck
+    static constexpr int initialCards() { return 2; }          // cards drawn by each player at startup
+    static constexpr int bombDivisor() { return 2; }           // a bomb removes armies / N
+};
+
+/**
+ * @brief Values of a configurable rule set (defaults are the standard rules).
+ */
+struct RuleSet {
+    double attackerKillProbability = StandardRules::attackerKillProbability();
+    double defenderKillProbability = StandardRules::defenderKillProbability();
+    int reinforcementDivisor = StandardRules::reinforcementDivisor();
+    int minimumReinforcement = StandardRules::minimumReinforcement();
+    int startingArmies = StandardRules::startingArmies();
+    int cardsPerType = StandardRules::cardsPerType();
+    int initialCards = StandardRules::initialCards();
+    int bombDivisor = StandardRules::bombDivisor();
+
+    static RuleSet load(const std::string& path); // key=value lines over the standard rules, validated
+    void set(const std::string& key, const std::string& value); // key is a member name
+    void validate() const; // throws std::invalid_argument on out-of-range values
+    bool operator==(const RuleSet& other) const;
+    bool operator!=(const RuleSet& other) const;
+    friend std::ostream& operator<<(std::ostream& os, const RuleSet& rules);
+};
+
+/**
+ * @brief Rules read from a process-wide RuleSet, configurable at runtime.
+ */
+struct RuntimeRules {
+    static RuleSet& settings(); // process-wide rule values
+    static void configure(const RuleSet& rules); // validates then installs the rule set
+
+    static double attackerKillProbability() { return settings().attackerKillProbability; }
+    static double defenderKillProbability() { return settings().defenderKillProbability; }
+    static int reinforcementDivisor() { return settings().reinforcementDivisor; }
+    static int minimumReinforcement() { return settings().minimumReinforcement; }
+    static int startingArmies() { return settings().startingArmies; }
+    static int cardsPerType() { return settings().cardsPerType; }
+    static int initialCards() { return settings().initialCards; }
+    static int bombDivisor() { return settings().bombDivisor; }
+};
+
+#ifdef WARZONE_RUNTIME_RULES
+using ActiveRules = RuntimeRules;
+constexpr bool RULES_CONFIGURABLE = true;
+#else
+using ActiveRules = StandardRules;
+constexpr bool RULES_CONFIGURABLE = false; // RuntimeRules::configure() has no effect on the game
+#endif
+
+RuleSet activeRuleSet(); // values of ActiveRules
+
+// ======================= Rule kernels =======================
+
+namespace GameRules {
+
+    /**
+     * @brief Territory-based reinforcement income (continent bonuses excluded)
+     * @param territoryCount Number of territories owned
+     * @return floor(territoryCount / divisor), at least the minimum reinforcement
+     */
+    template <class Rules>
+    int baseReinforcement(int territoryCount) {
+        return std::max(territoryCount / Rules::reinforcementDivisor(), Rules::minimumReinforcement());
+    }
+
+    /**
+     * @brief Armies destroyed by a bomb
+     * @param armies Armies on the bombed territory
+     * @return Number of armies removed
+     */
+    template <class Rules>
+    ArmyCount bombCasualties(ArmyCount armies) {
+        return armies / Rules::bombDivisor();
+    }
+}
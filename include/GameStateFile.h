@@ -0,0 +1,120 @@
+/**
+ * @file GameStateFile.h
+ * @brief Memory-mapped, phase-committed record of a running game for crash recovery.
+ *
+ * @details
+ *  A long tournament worker or a hosted game used to lose everything when its process died.
+ *  A GameStateFile keeps the mutable state of one game in a memory-mapped file, laid out as a
+ *  fixed struct-of-arrays sized when the game starts:
+ *   - per territory: owner (player slot, -1 if none, -2 for the Neutral player) and armies,
+ *   - per player slot: reinforcement pool, alive flag and current strategy name,
+ *   - per card: type and holder (-1 for the deck, else the player slot), in deck/hand order,
+ *   - the turn number and the last completed phase,
+ *   - the state of the game's random engine (GameContext::getRandom()), as its raw binary state.
+ *
+ *  The board lives in the mapping: the file listens to the territories (TerritoryListener) and
+ *  writes every owner or army change into a live region as it happens, one store per change.
+ *  The engine commits the state at two phase boundaries of every turn (after reinforcement, and
+ *  at the end of the turn). A commit copies the live board into the inactive of two slots in one
+ *  block, adds the pools, cards and random engine, then a word-wise checksum of the bytes written,
+ *  then its sequence number (the commit marker); the previous commit stays intact until the new
+ *  one is complete. `attach()` re-opens the file after a crash and selects the newest slot whose
+ *  marker and checksum are valid, and `GameEngine::resumeGame()` continues from that phase.
+ *
+ *  Commits do not call `msync`: the page cache keeps the mapping through a crash of the process.
+ *  Call sync() where the state must also survive a crash of the machine.
+ *
+ * @note Issued but unexecuted orders are not recorded: a game that died during the issue or
+ *       execute phase resumes after the reinforcement of that turn and issues its orders again.
+ *       Since the random engine is restored with the board, a game resumed from a commit draws
+ *       the same player order, cards and battle seeds as the original did after that commit.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iosfwd>
+#include "Map.h"
+
+class Player;
+class GameContext;
+
+/**
+ * @brief Last phase of a turn whose state was committed.
+ */
+enum class CommittedPhase : std::int32_t {
+    None = 0,       ///< Nothing committed yet
+    Reinforced = 1, ///< Reinforcement pools of the turn were granted
+    TurnEnded = 2   ///< Orders executed, cards awarded and defeated players removed
+};
+
+/**
+ * @class GameStateFile
+ * @brief Fixed-layout game state in a memory-mapped file, committed once per phase.
+ * @ownership Listens to the territories of the recorded map (not owned) while it is open.
+ */
+class GameStateFile : public TerritoryListener {
+public:
+    static const std::size_t NAME_SIZE = 64; ///< Bytes reserved for a map, player or strategy name
+    static const std::int32_t NO_OWNER = -1;
+    static const std::int32_t NEUTRAL_OWNER = -2; ///< Owner slot of the context's Neutral player
+
+    explicit GameStateFile(const std::string& path); // nothing is mapped until create()/attach()
+    ~GameStateFile() override;
+
+    // Size and map a new file for a game that just started (players in turn order)
+    bool create(const std::string& mapName, const Map& map, const std::vector<Player*>& players,
+                const GameContext& context);
+    bool attach(); // map an existing file; true if it holds a committed phase
+
+    void commit(int turn, CommittedPhase phase, const Map& map, const std::vector<Player*>& players,
+                const GameContext& context);
+    // Board (Neutral territories included), pools, cards and random engine
+    void restore(Map& map, const std::vector<Player*>& slotPlayers, GameContext& context);
+    void sync() const; // write the mapping back to disk (survives a crash of the machine)
+
+    bool isOpen() const;
+    const std::string& getPath() const;
+    std::string getMapName() const;
+    std::size_t getSlotCount() const; // player slots, in turn order
+    std::string getPlayerName(std::size_t slot) const;
+    std::string getStrategyName(std::size_t slot) const; // "" if the player has no strategy
+    bool isAlive(std::size_t slot) const;
+    int getTurn() const;
+    CommittedPhase getPhase() const;
+    std::uint64_t getSequence() const; // number of commits so far
+
+    // Live board: owner and armies of a recorded territory written into the mapping
+    void territoryChanged(const Territory& territory, Player* previousOwner, ArmyCount previousArmies) override;
+    void territoryDestroyed(const Territory& territory) override;
+
+    GameStateFile(const GameStateFile&) = delete; // owns the mapping
+    GameStateFile& operator=(const GameStateFile&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const GameStateFile& file);
+
+private:
+    struct Layout; // offsets of the arrays, derived from the header
+
+    bool mapFile(int fd, std::size_t bytes);
+    void unmap();
+    unsigned char* slot(int index) const;
+    std::uint64_t checksumOf(const unsigned char* slotData) const;
+    bool slotIsValid(int index) const;
+    void bindPlayers(const std::vector<Player*>& slotPlayers);
+    void bindBoard(const Map& map, const GameContext& context); // listen and write the whole live board
+    void unbindBoard();
+    void writeLive(const Territory& territory, std::size_t index);
+    int slotOf(const Player* player, const Player* neutral) const;
+
+    std::string path;
+    unsigned char* data; // mapped file, nullptr if not open
+    std::size_t size;
+    Layout* layout;
+    int current; // slot holding the newest valid commit, -1 if none
+    std::vector<const Player*> slotPlayers; // player of each slot in this process (never dereferenced)
+    std::vector<Territory*> board; // recorded territories in file order (nullptr once destroyed)
+    std::vector<std::int32_t> boardIndex; // file order index of each territory id, -1 if not recorded
+    const GameContext* boardContext; // supplies the Neutral player of the live board
+};
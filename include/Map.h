@@ -18,14 +18,60 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <iosfwd>
+#include "TerritoryBitset.h"
+#include "ArmyCount.h"
 
 class Player;
 class Continent;
+class Territory;
 enum class MapFileSections { None, Map, Continents, Territories };
 
+/**
+ * @class TerritoryListener
+ * @brief Notified after the owner or the armies of a Territory it listens to change.
+ *
+ * @details Used by structures that keep summaries of the board up to date incrementally
+ *          (e.g. ContinentGraph) instead of rescanning every territory.
+ *
+ * @ownership Territories hold non-owning pointers; a listener must detach itself (or outlive
+ *            the territories) before it is destroyed.
+ */
+class TerritoryListener {
+public:
+    virtual ~TerritoryListener();
+    virtual void territoryChanged(const Territory& territory, Player* previousOwner, ArmyCount previousArmies) = 0;
+    virtual void territoryDestroyed(const Territory& territory); // default: nothing to forget
+};
+
+
+/**
+ * @brief What Map::normalizeAdjacency() fixed in the adjacency lists of a map.
+ */
+struct AdjacencyReport {
+    int duplicates = 0;   ///< Repeated neighbour entries removed
+    int selfLoops = 0;    ///< Territories listing themselves, removed
+    int nullEntries = 0;  ///< Null neighbour pointers removed
+    int oneWayEdges = 0;  ///< Edges listed on one side only, mirrored on the other side
+    int edges = 0;        ///< Undirected edges after normalization
+
+    bool changed() const; // true if anything was fixed
+};
+std::ostream& operator<<(std::ostream& os, const AdjacencyReport& report);
+
+/**
+ * @brief Id locality of a map before and after Map::renumberForLocality().
+ */
+struct RenumberReport {
+    int bandwidthBefore = 0;    ///< Largest id difference across an edge, before
+    int bandwidthAfter = 0;     ///< Largest id difference across an edge, after
+    double meanGapBefore = 0.0; ///< Mean id difference across an edge, before
+    double meanGapAfter = 0.0;  ///< Mean id difference across an edge, after
+};
+std::ostream& operator<<(std::ostream& os, const RenumberReport& report);
 
 /**
  * @class Territory
@@ -43,6 +89,10 @@ enum class MapFileSections { None, Map, Continents, Territories };
  * @invariant
  *  - `continent` is non-null for a valid, validated map.
  *  - Adjacency is symmetric (if A lists B, B lists A).
+ *  - After `Map::normalizeAdjacency()`, neighbours are unique and sorted by id, so
+ *    `isAdjacentTo()` binary-searches and neighbour sets can be merged linearly.
+ *  - `hasSymmetricAdjacency()` is true only while that is known: normalization sets it, and an
+ *    edge added one way or a cleared list resets it on both ends.
  *
  * @ownership
  *  - `continent` and adjacent territories are **non-owning pointers** (owned by Map/Continent).
@@ -55,7 +105,7 @@ class Territory{
 public:
     Territory(); // default constructor
     Territory(const Territory& other); // copy constructor
-    Territory(int id, const std::string& name, Player* owner, int armies); // parameterized constructor
+    Territory(int id, const std::string& name, Player* owner, ArmyCount armies); // parameterized constructor
     Territory(int id, const std::string& name); // parameterized constructor
     ~Territory(); // destructor
 
@@ -64,28 +114,51 @@ public:
 
     // note some setter might not be needed but added for completeness
     int getId() const;
-    std::string getName() const;
+    int getOriginalId() const; // id from the map file, kept across renumbering (logs, saved games)
+    void renumber(int newId); // Map::renumberForLocality() only: neighbours' masks must be rebuilt
+    const std::string& getName() const;
+    int getX() const; // coordinates from the map file (drawing only)
+    int getY() const;
+    void setCoordinates(int x, int y);
     Player* getOwner() const;
     const std::vector<Continent*>& getContinents() const;
     void addContinent(Continent* c);
     void clearContinents();
-    int getArmies() const;
+    ArmyCount getArmies() const;
     void setOwner(Player* newOwner);
-    void setArmies(int newArmies);
-    void addArmies(int additionalArmies);
-    void removeArmies(int removedArmies);
+    void setArmies(ArmyCount newArmies); // clamped to [0, Armies::MAX]
+    void addArmies(ArmyCount additionalArmies); // saturates at Armies::MAX
+    void removeArmies(ArmyCount removedArmies); // stops at 0
     void addAdjacent(Territory* t);
     void clearAdjacents();
-    bool isAdjacentTo(const Territory* t) const;
+    void normalizeAdjacents(AdjacencyReport& report); // sort by id, drop duplicates/self-loops/nulls
+    bool isAdjacentTo(const Territory* t) const; // O(log d) once the neighbours are sorted
     const std::vector<Territory*>& getAdjacents() const;
+    const TerritoryBitset* getNeighbourMask() const; // neighbour ids; nullptr if one is beyond the masked range
+    bool hasSymmetricAdjacency() const; // every neighbour lists this territory back, and only they do
+    std::uint64_t getVersion() const; // bumped by every change of owner, armies or neighbours
+    void addListener(TerritoryListener* listener); // listeners are not copied with the territory
+    void removeListener(TerritoryListener* listener);
 
 private:
+    void notifyListeners(Player* previousOwner, ArmyCount previousArmies) const;
+
     int id;
+    int originalId; // id assigned when the map was loaded (file order)
     std::string name;
+    int x, y; // coordinates from the map file, kept so the map can be written back (MapWriter)
     std::vector<Continent*> continents; // pointer to the continent the territory belongs to (exactly one per territory)
     Player* owner; // pointer to the player who owns the territory
-    int armies; // number of armies in the territory
+    ArmyCount armies; // number of armies in the territory, within [0, Armies::MAX]
     std::vector<Territory*> adjacentTerritories; // list of pointers to adjacent territories
+    bool adjacentsSorted; // neighbours strictly increasing by id (binary search allowed)
+    std::uint64_t version; // change counter of owner/armies/neighbours (order validation cache)
+    TerritoryBitset neighbourMask; // ids of adjacentTerritories (see TerritoryBitset.h)
+    bool neighbourMaskComplete; // every neighbour id is below TerritoryBitset::MAX_MASKED_ID
+    bool symmetricAdjacency; // known symmetric since the last Map::normalizeAdjacency() (Map sets it)
+    std::vector<TerritoryListener*> listeners; // non-owning, notified on owner/army changes
+
+    friend class Map;
 };
 
 /**
@@ -115,12 +188,13 @@ public:
     Continent& operator=(const Continent& other); // copy assignment operator
 
     int getId() const;
-    std::string getName() const;
+    const std::string& getName() const;
     int getBonus() const;
     void setBonus(int bonus);
     void addTerritory(Territory* territory);
     void clearTerritories();
     const std::vector<Territory*>& getTerritories() const;
+    const TerritoryBitset* getTerritoryMask() const; // member ids; nullptr if one is beyond the masked range
 
     friend std::ostream& operator<<(std::ostream& os, const Continent& continent);
 
@@ -129,6 +203,8 @@ private:
     std::string name;
     int bonus; // bonus armies awarded for controlling the entire continent
     std::vector<Territory*> territories; // list of pointers to territories in the continent
+    TerritoryBitset territoryMask; // ids of the territories (see TerritoryBitset.h)
+    bool territoryMaskComplete; // every member id is below TerritoryBitset::MAX_MASKED_ID
 };
 
 /**
@@ -161,8 +237,15 @@ public:
 
     void addTerritory(Territory* territory);
     void addContinent(Continent* continent);
+    void reserveTerritories(std::size_t count); // capacity hint for bulk loading
+    AdjacencyReport normalizeAdjacency(); // dedupe, drop self-loops, mirror one-way edges, sort by id
+    bool confirmSymmetricAdjacency(); // marks the territories symmetric if every edge is mirrored
+    RenumberReport renumberForLocality(); // Reverse Cuthill-McKee ids and storage order; before owners are set
+    std::vector<Territory*> getTerritoriesInFileOrder() const; // sorted by original id
     const std::vector<Territory*>& getTerritories() const;
     const std::vector<Continent*>& getContinents() const;
+    void addMetadata(const std::string& line); // "key=value" line of the [Map] section
+    const std::vector<std::string>& getMetadata() const;
     void clear(); // Clean up all dynamically allocated objects
 
     // 1) map connected
@@ -175,6 +258,7 @@ public:
 private:
     std::vector<Territory*> territories; // list of pointers to all territories in the map
     std::vector<Continent*> continents; // list of pointers to all continents in the map
+    std::vector<std::string> metadata; // [Map] section lines (author, image, wrap, ...), in file order
 
 };
 
@@ -191,8 +275,12 @@ private:
  *  - On success, returns a heap-allocated `Map*` (caller takes ownership).
  *  - On failure, returns `nullptr`.
  *
- * @note Robust loaders should verify section order, unique ids/names, symmetric edges,
- *       and consistent continent membership during or after parsing.
+ *  Maps of the default directory are read from the packed archive (see MapArchive.h) when it
+ *  holds the current contents of the file; `parseMapFile()` always parses the text.
+ *
+ * @note After parsing, `parseMapFile()` runs `Map::normalizeAdjacency()` so duplicate, self-referencing
+ *       and one-way neighbour entries of community maps are repaired (and reported) once, instead
+ *       of being paid for by every traversal.
  */
 class MapLoader {
 public:
@@ -203,7 +291,8 @@ public:
     MapLoader& operator=(const MapLoader&);// copy assignment operator
     friend std::ostream& operator<<(std::ostream& os, const MapLoader& ml);
 
-    bool loadMap(const std::string& filename, Map& mapOutput); // load a map from a .map file
+    bool loadMap(const std::string& filename, Map& mapOutput); // load a map (packed archive if up to date)
+    bool parseMapFile(const std::string& filename, Map& mapOutput); // always parse the .map text
     std::vector<std::string> getMapFiles(); // get list of map files
     void printMapFiles(const std::vector<std::string>& mapFiles); // print a list of map files
 private:
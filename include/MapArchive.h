@@ -0,0 +1,67 @@
+/**
+ * @file MapArchive.h
+ * @brief Packed, pre-parsed map archive read through a memory mapping.
+ *
+ * @details
+ *  Loading a map used to mean opening its `.map` file and parsing the text. A MapArchive holds
+ *  every map of a directory in one binary file (`assets/maps.pack` for `assets/maps`), already
+ *  parsed and normalized:
+ *   - a header and an index sorted by file name (name, content hash, blob offset and size),
+ *   - one blob per map: continents, territories, and the adjacency as flat index arrays (CSR),
+ *     followed by the map's string table.
+ *
+ *  The archive is mapped once per process (`mmap`); decoding a map only reads the mapping and
+ *  allocates the Map objects, no file is opened per load. `MapLoader::loadMap()` reads a map from
+ *  the archive when the MapIndex entry of the file points to it (`cachePath`) and the content hash
+ *  recorded in the archive still matches the file; otherwise the text file is parsed as before.
+ *
+ *  `pack()` (subcommand `pack-maps`) builds the archive from the text files of an index and
+ *  records it as the compiled cache of every packed entry.
+ *
+ * @note The archive is a cache in native byte order: deleting it is always safe, and an archive
+ *       written on a machine with another byte order is ignored.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <iosfwd>
+
+class Map;
+class MapIndex;
+
+/**
+ * @class MapArchive
+ * @brief Read-only view of a packed map archive, mapped into memory.
+ */
+class MapArchive {
+public:
+    static const char* const ARCHIVE_EXTENSION; ///< ".pack", appended to the map directory
+
+    explicit MapArchive(const std::string& path); // maps the file; isOpen() is false on failure
+    ~MapArchive();
+
+    static MapArchive& shared(const std::string& path); // opened once per process and path
+    static int pack(MapIndex& index); // pack every parsable map of the index; returns the map count
+
+    bool isOpen() const;
+    std::size_t getMapCount() const;
+    const std::string& getPath() const;
+
+    // Decode a map into mapOutput; false if the archive has no entry with this name and hash
+    bool load(const std::string& fileName, std::uint64_t contentHash, Map& mapOutput) const;
+
+    MapArchive(const MapArchive&) = delete; // owns the mapping
+    MapArchive& operator=(const MapArchive&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const MapArchive& archive);
+
+private:
+    const unsigned char* findBlob(const std::string& fileName, std::uint64_t contentHash,
+                                  std::uint64_t& size) const;
+
+    std::string path;
+    const unsigned char* data; // mapped file, nullptr if not open
+    std::size_t size;
+    std::size_t mapCount;
+};
@@ -0,0 +1,80 @@
+/**
+ * @file MapIndex.h
+ * @brief Metadata index of the map directory for instant listing and selection.
+ *
+ * @details
+ *  Choosing a map used to mean opening and fully parsing it. The MapIndex keeps a small text file
+ *  next to the map directory (`assets/maps.index` for `assets/maps`) with one entry per `.map` file:
+ *   - file name and display name,
+ *   - territory / continent / edge counts and the result of `Map::validate()`,
+ *   - last-write time, size and content hash of the file,
+ *   - location of the packed archive holding the map (empty when none exists, see MapArchive.h).
+ *
+ *  `refresh()` only stats the directory: entries whose mtime and size are unchanged are kept as is,
+ *  entries whose content hash is unchanged only get their mtime updated, and only new or modified
+ *  files are parsed. Listing (`MapLoader::getMapFiles/printMapFiles`), `loadmap` existence checks and
+ *  tournament `-M` validation answer from the index.
+ *
+ * @note The index is a cache: deleting the file is always safe, it is rebuilt on the next refresh.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iosfwd>
+
+/**
+ * @brief Metadata recorded for one map file.
+ */
+struct MapIndexEntry {
+    std::string fileName;         ///< File name relative to the map directory (e.g. "World.map")
+    std::string displayName;      ///< File name without the .map extension
+    int territoryCount = 0;
+    int continentCount = 0;
+    int edgeCount = 0;            ///< Undirected edges after normalization (as AdjacencyReport::edges)
+    bool valid = false;           ///< Map loaded and passed Map::validate()
+    long long mtime = 0;          ///< Last write time of the file (filesystem clock ticks)
+    std::uintmax_t fileSize = 0;
+    std::uint64_t contentHash = 0; ///< FNV-1a hash of the file contents
+    std::string cachePath;        ///< Packed archive holding the map ("" when none exists)
+};
+
+/**
+ * @class MapIndex
+ * @brief Persistent, lazily refreshed index of the `.map` files in a directory.
+ */
+class MapIndex {
+public:
+    static const char* const DEFAULT_MAP_DIRECTORY; ///< "assets/maps"
+
+    MapIndex(); // default constructor (indexes DEFAULT_MAP_DIRECTORY)
+    MapIndex(const std::string& mapDirectory); // index kept next to mapDirectory
+    MapIndex(const MapIndex& other); // copy constructor
+    ~MapIndex();
+
+    MapIndex& operator=(const MapIndex& other); // copy assignment operator
+    friend std::ostream& operator<<(std::ostream& os, const MapIndex& index);
+
+    static MapIndex& forDefaultDirectory(); // shared index of assets/maps
+
+    bool refresh(); // rescan the directory; returns true if the index changed
+    const MapIndexEntry* find(const std::string& fileName); // nullptr if the map does not exist
+    const std::vector<MapIndexEntry>& getEntries(); // sorted by file name
+    std::vector<std::string> getMapFiles(); // full paths, sorted by file name
+    void setCachePath(const std::string& fileName, const std::string& cachePath);
+
+    bool load();
+    bool save() const;
+
+    const std::string& getDirectory() const;
+    const std::string& getIndexPath() const;
+
+private:
+    void ensureFresh(); // refresh once per process on first use
+
+    std::string directory; // directory containing the .map files
+    std::string indexPath; // index file, next to the directory
+    bool fresh;            // true once the directory was scanned in this process
+    std::vector<MapIndexEntry> entries; // sorted by fileName
+};
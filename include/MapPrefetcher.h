@@ -0,0 +1,89 @@
+/**
+ * @file MapPrefetcher.h
+ * @brief Background stage that loads and validates the maps of upcoming tournament games.
+ *
+ * @details
+ *  A tournament plays G games on each of M maps, and every game used to start by reading, parsing
+ *  and validating its map on the thread that then simulates it. The prefetcher moves that work to
+ *  a stage thread, a few games ahead of the simulation:
+ *   - each map is loaded (packed archive or text), renumbered if requested and validated once,
+ *   - every game of the map then gets its own copy of that pristine map (a copy is much cheaper
+ *     than a parse),
+ *   - the prepared maps wait in a queue bounded by the prefetch depth, in game order.
+ *  The simulation takes them with next(), which only blocks when the stage fell behind; the time
+ *  spent blocked is reported by getWaitMilliseconds(). With profiling on, the stage measures its
+ *  loads and validations (getProfile()), since they no longer run on the simulation thread.
+ *
+ * @note While a prefetcher runs it is the only user of the map loader, the map index and the map
+ *       archive; the games it feeds only read their own copies. Diagnostics of the loader (e.g.
+ *       adjacency repairs) are printed from the stage thread.
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Map.h"
+#include "PerfCounters.h"
+
+/**
+ * @brief Map of one tournament game, as prepared by the stage thread.
+ * @ownership `map` belongs to whoever took the PreparedMap from next().
+ */
+struct PreparedMap {
+    std::string mapName;     ///< Map file name (relative to assets/maps/)
+    int game = 0;            ///< Game number on this map, from 0
+    Map* map = nullptr;      ///< Fresh map for the game; nullptr if loading failed
+    bool valid = false;      ///< Result of Map::validate()
+    bool renumbered = false; ///< Whether `report` holds a renumbering
+    RenumberReport report;   ///< Renumbering of the map (same for every game of the map)
+    std::string error;       ///< Loading error, when `map` is nullptr
+};
+
+/**
+ * @class MapPrefetcher
+ * @brief Bounded producer of PreparedMap, one per (map, game) in tournament order.
+ */
+class MapPrefetcher {
+public:
+    static const std::size_t DEFAULT_DEPTH = 2; ///< Games prepared ahead of the simulation
+
+    MapPrefetcher(const std::vector<std::string>& mapNames, int gamesPerMap, bool renumber,
+                  bool profile = false, std::size_t depth = DEFAULT_DEPTH);
+    ~MapPrefetcher(); // stops the stage and deletes the maps nobody took
+
+    PreparedMap next(); // blocks until the next game's map is ready
+    double getWaitMilliseconds() const; // time next() spent blocked
+    std::size_t getPrepared() const;    // maps handed out so far
+    PhaseProfile getProfile() const;    // loads and validations measured so far
+
+    MapPrefetcher(const MapPrefetcher&) = delete;
+    MapPrefetcher& operator=(const MapPrefetcher&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const MapPrefetcher& prefetcher);
+
+private:
+    void run(); // stage thread
+    bool push(PreparedMap prepared); // false if the prefetcher is stopping
+
+    std::vector<std::string> mapNames;
+    int gamesPerMap;
+    bool renumber;
+    bool profile;
+    std::size_t depth;
+
+    mutable std::mutex mutex;
+    std::condition_variable ready;   // a map was queued (or the stage finished)
+    std::condition_variable taken;   // a map was taken (or the prefetcher is stopping)
+    std::deque<PreparedMap> queue;
+    bool finished;  // the stage queued every game
+    bool stopping;  // the destructor runs
+    double waitMilliseconds;
+    std::size_t handedOut;
+    PhaseProfile stageProfile; // written by the stage thread under the mutex
+    std::thread stage;
+};
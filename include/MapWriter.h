@@ -0,0 +1,80 @@
+/**
+ * @file MapWriter.h
+ * @brief Buffered writers of a Map to Conquest `.map` text and of a game to JSON.
+ *
+ * @details
+ *  The printers of Map, Territory and Continent are meant for people: verbose, formatted through
+ *  iostreams one field at a time. Writing a board for another program (a generated map saved to
+ *  disk, a server snapshot) goes through a BufferedWriter instead:
+ *   - text is appended to a 64 KiB buffer handed to the stream in whole blocks,
+ *   - integers are formatted with `std::to_chars` straight into the buffer,
+ *   - names are copied from the territories by reference, never as temporary strings.
+ *
+ *  writeConquest() writes the `[Map]`, `[Continents]` and `[Territories]` sections that
+ *  MapLoader::parseMapFile() reads back into the same map: the `[Map]` lines (author, image,
+ *  wrap, ...) as they were read, continents in id order with their bonus, territories in file
+ *  order (original ids) with their coordinates, continent and neighbours by name. Comments, blank
+ *  lines and the order of neighbours within a line are not kept (neighbours come out sorted by id).
+ *
+ *  writeJson() writes the map as one JSON object; writeGameStateJson() wraps it with the state,
+ *  the turn, the owner and armies of every territory and a summary of every player. Both stream:
+ *  nothing is built in memory beyond the buffer.
+ *
+ * @note Territory and continent names cannot contain commas in the Conquest format (MapLoader
+ *       splits on them), so a map that was loaded from a `.map` file always round-trips.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Map;
+class Player;
+
+/**
+ * @class BufferedWriter
+ * @brief Append-only text buffer flushed to a stream in blocks.
+ */
+class BufferedWriter {
+public:
+    static constexpr std::size_t BUFFER_SIZE = std::size_t(1) << 16;
+
+    explicit BufferedWriter(std::ostream& out);
+    ~BufferedWriter(); // flushes
+
+    BufferedWriter& put(char c);
+    BufferedWriter& write(std::string_view text);
+    BufferedWriter& writeInteger(std::int64_t value);
+    BufferedWriter& writeJsonString(std::string_view text); // quoted, with JSON escapes
+    void flush();
+    std::size_t getBytesWritten() const; // flushed or buffered
+
+    BufferedWriter(const BufferedWriter&) = delete; // refers to one stream
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+private:
+    void reserve(std::size_t bytes); // flush unless the buffer has room for bytes more
+
+    std::ostream& out;
+    std::unique_ptr<char[]> buffer; // BUFFER_SIZE bytes, not initialized
+    std::size_t used;     // bytes of buffer not flushed yet
+    std::size_t flushed;  // bytes handed to the stream so far
+};
+
+namespace MapWriter {
+    // Conquest .map text read back by MapLoader (title: "name=" line for a map without [Map] lines)
+    void writeConquest(const Map& map, std::ostream& out, const std::string& title = "");
+
+    // {"continents":[...],"territories":[...]} with owners and armies
+    void writeJson(const Map& map, std::ostream& out);
+    void writeJson(const Map& map, BufferedWriter& out);
+
+    // {"state":...,"turn":...,"map":{...},"players":[...]}
+    void writeGameStateJson(const Map& map, const std::vector<Player*>& players, const std::string& state,
+                            int turn, std::ostream& out);
+}
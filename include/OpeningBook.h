@@ -0,0 +1,114 @@
+/**
+ * @file OpeningBook.h
+ * @brief Persistent opening book for early-turn bot decisions.
+ *
+ * @details
+ *  `gamestart` deals the territories in file order, so the first turns of a bot game start from
+ *  the same board in every tournament game; only the (shuffled) turn order changes. The position
+ *  is therefore hashed canonically, from the point of view of the player deciding: owners are
+ *  "this player" or the other players ranked by name, never seats. The OpeningBook memoizes the
+ *  decisions taken from those positions:
+ *   - Key:   (map hash, player count, turn, position hash).
+ *   - Value: the Deploy/Advance orders the strategy issued from that position.
+ *
+ *  The position hash covers owners, armies, the player's reinforcement pool, the card types in its
+ *  hand and its strategy, so a replay stands for the whole issue phase of that strategy; phases
+ *  that issued any other order (e.g. a card) are never recorded.
+ *
+ *  Strategies opt in through `PlayerStrategy::openingBookId()`. The GameEngine looks positions up
+ *  in O(1) at the start of the issue phase, replays hits, and records misses (lazy population)
+ *  until the book holds `capacity` entries. The book is stored as a plain text file so it can be
+ *  shared across runs and inspected by hand.
+ *
+ * @note Only the GameEngine talks to the book; strategies never see it.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <iosfwd>
+
+class Map;
+class Player;
+
+/**
+ * @brief Lookup key of one opening book entry.
+ */
+struct OpeningBookKey {
+    std::uint64_t mapHash = 0;      ///< Hash of the map topology (see OpeningBook::hashMap)
+    int playerCount = 0;            ///< Number of players in the game
+    int turn = 0;                   ///< 1-based turn number
+    std::uint64_t positionHash = 0; ///< Hash of the board as seen by the player (see OpeningBook::hashPosition)
+
+    bool operator==(const OpeningBookKey& other) const;
+};
+
+/** @brief Hash functor so OpeningBookKey can be used in unordered containers. */
+struct OpeningBookKeyHash {
+    std::size_t operator()(const OpeningBookKey& key) const;
+};
+
+/**
+ * @brief A single recorded order, stored by territory id so it survives across games.
+ */
+struct OpeningBookMove {
+    enum class Type { Deploy, Advance };
+
+    Type type = Type::Deploy;
+    int sourceId = -1; ///< Unused for Deploy
+    int targetId = -1;
+    int amount = 0;
+};
+
+/**
+ * @class OpeningBook
+ * @brief Memo table from early-game positions to the orders a strategy issued there.
+ *
+ * @details
+ *  The book is loaded lazily on first lookup and written back by `save()` only when new entries
+ *  were recorded. Missing, unreadable or older-format files simply start an empty book. Once the
+ *  book holds `capacity` entries, further positions are looked up but no longer recorded, so the
+ *  file stops growing.
+ */
+class OpeningBook {
+public:
+    static const int DEFAULT_DEPTH = 3; ///< Number of opening turns the engine consults the book for
+    static const std::size_t DEFAULT_CAPACITY = 4096; ///< Maximum number of recorded positions
+
+    OpeningBook(); // default constructor (in-memory only, nothing is saved)
+    OpeningBook(const std::string& path, int depth = DEFAULT_DEPTH,
+                std::size_t capacity = DEFAULT_CAPACITY); // book backed by a file
+    OpeningBook(const OpeningBook& other); // copy constructor
+    ~OpeningBook();
+
+    OpeningBook& operator=(const OpeningBook& other); // copy assignment operator
+    friend std::ostream& operator<<(std::ostream& os, const OpeningBook& book);
+
+    static std::uint64_t hashMap(const Map& map);
+    static std::uint64_t hashPosition(const Map& map, const std::vector<Player*>& players,
+                                      const Player* player, const std::string& strategyId);
+
+    const std::vector<OpeningBookMove>* lookup(const OpeningBookKey& key);
+    void record(const OpeningBookKey& key, const std::vector<OpeningBookMove>& moves);
+
+    bool load();
+    bool save();
+
+    int getDepth() const;
+    std::size_t getCapacity() const;
+    std::size_t size() const;
+    std::size_t getHits() const;
+    std::size_t getMisses() const;
+
+private:
+    std::string path;  // backing file ("" = in-memory only)
+    int depth;         // number of opening turns covered
+    std::size_t capacity; // maximum number of entries
+    bool loaded;       // true once the backing file was read (or found missing)
+    bool dirty;        // true when entries were recorded since the last save
+    std::size_t hits;
+    std::size_t misses;
+    std::unordered_map<OpeningBookKey, std::vector<OpeningBookMove>, OpeningBookKeyHash> entries;
+};
@@ -0,0 +1,42 @@
+/**
+ * @file OrderCoalescing.h
+ * @brief Optional pass that merges redundant Deploy and Advance orders before they execute.
+ *
+ * @details
+ *  Bots issue orders one at a time in the round-robin issue loop, so a turn often holds several
+ *  Deploys to the same territory and several Advances along the same source-to-target pair, each
+ *  validated, executed, described and logged on its own. The engine can run this pass before each
+ *  part of the execute phase (`GameEngine::setOrderCoalescing()`):
+ *
+ *   - coalesceDeploys(), before the deploys: the Deploys of a player to one territory that would
+ *     all succeed are merged into the first of them and removed from the list.
+ *     Deploys of different players never interact and a player's deploys only share its pool, so
+ *     the board and pools after the deploy part are exactly those of the unmerged orders. Deploys
+ *     that would fail (short pool, territory not owned) are left in place and still fail.
+ *
+ *   - coalesceAdvances(), before the other orders: the Advances of a player along one pair that
+ *     would all be valid are merged into the first of them, and the others are marked coalesced:
+ *     they keep their slot in the round robin (so the other players' orders still run in the same
+ *     passes) but are skipped. A pair is merged only when no other order of the phase touches its
+ *     source or target and no Negotiate involves the issuer, so nothing can change between the
+ *     merged orders. A battle loses one army per round whatever the army sizes, so one battle with
+ *     the summed attackers has the same outcome distribution as the successive battles (and as a
+ *     conquest followed by moves into the conquered territory).
+ *
+ * @note Both passes only merge orders that would succeed; validity is decided on the state the
+ *       orders will execute in, so they must run right before the corresponding part of the phase.
+ */
+
+#pragma once
+#include <vector>
+
+class Player;
+
+namespace OrderCoalescing {
+
+    // Merge same-target Deploys of each player; returns the number of orders removed
+    int coalesceDeploys(const std::vector<Player*>& players);
+
+    // Merge same-pair Advances of each player; returns the number of orders marked coalesced
+    int coalesceAdvances(const std::vector<Player*>& players);
+}
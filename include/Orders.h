@@ -10,24 +10,54 @@
  *
  * Implementation notes:
  *  - AdvanceOrder::validate() defers adjacency to Map API
+ *  - validate() results are cached with the versions of the players/territories they read
  *  - execute() methods set effect strings
  */
 
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
 #include <vector>
 #include <iosfwd>
 #include "LoggingObserver.h"
+#include "ArmyCount.h"
 
 
 class Player;
 class Territory;
 
+// ======================= Validation cache =======================
+/**
+ * @brief Last validate() result of an order, with the versions of the players and territories it read
+ *
+ * @details Territory::getVersion() and Player::getVersion() change with every mutation, so while
+ *          the recorded versions are current the recorded result still holds and validate() is
+ *          O(1). Orders validate when issued and again when executed; nothing in between usually
+ *          touches what they read.
+ */
+class ValidationCache {
+public:
+    static const std::size_t MAX_VERSIONS = 3; ///< Entities an order's validity depends on, at most
+
+    bool isCurrent(std::initializer_list<std::uint64_t> versions) const; // versions match the recorded ones
+    bool getResult() const;
+    bool record(std::initializer_list<std::uint64_t> versions, bool valid); // returns valid
+
+private:
+    bool known = false;
+    bool result = false;
+    std::uint64_t recorded[MAX_VERSIONS] = {};
+};
+
 // ======================= Base Order =======================
 class Order : public ILoggable , public Subject {
 protected:
     std::string description;
     std::string effect_;
+    bool coalesced_ = false; // merged into an earlier order; skipped at execution
+    mutable ValidationCache validation_; // validate() result while the entities it read are unchanged
 
     // Ensure no implicit conversions from string to Order
     explicit Order(std::string desc);
@@ -50,6 +80,10 @@ public:
     const std::string& effect() const;
     const std::string& getDescription() const;
 
+    // Order coalescing (see OrderCoalescing.h): a coalesced order keeps its turn slot but is not executed
+    bool isCoalesced() const;
+    void markCoalesced();
+
     friend std::ostream& operator<<(std::ostream& os, const Order& order);
 };
 
@@ -66,6 +100,11 @@ public:
     void execute() override;
     std::string name() const override;
 
+    Player* getIssuer() const;
+    Territory* getTarget() const;
+    int getAmount() const;
+    void setAmount(int amount);
+
 private:
     Player* issuer_ = nullptr;
     Territory* target_ = nullptr;
@@ -75,7 +114,7 @@ private:
 class AdvanceOrder : public Order {
 public:
     AdvanceOrder();
-    AdvanceOrder(Player* issuer, Territory* source, Territory* target, int amount);
+    AdvanceOrder(Player* issuer, Territory* source, Territory* target, ArmyCount amount);
     AdvanceOrder(const AdvanceOrder&);    
     Order* clone() const override;
 
@@ -83,11 +122,17 @@ public:
     void execute() override;
     std::string name() const override;
 
+    Player* getIssuer() const;
+    Territory* getSource() const;
+    Territory* getTarget() const;
+    ArmyCount getAmount() const;
+    void setAmount(ArmyCount amount);
+
 private:
     Player* issuer_ = nullptr;
     Territory* source_ = nullptr;
     Territory* target_ = nullptr;
-    int amount_ = 0;
+    ArmyCount amount_ = 0;
 };
 
 class BombOrder : public Order {
@@ -101,6 +146,9 @@ public:
     void execute() override;
     std::string name() const override;
 
+    Player* getIssuer() const;
+    Territory* getTarget() const;
+
 private:
     Player* issuer_ = nullptr;
     Territory* target_ = nullptr;
@@ -117,6 +165,9 @@ public:
     void execute() override;
     std::string name() const override;
 
+    Player* getIssuer() const;
+    Territory* getTarget() const;
+
 private:
     Player* issuer_ = nullptr;
     Territory* target_ = nullptr;
@@ -125,18 +176,24 @@ private:
 class AirliftOrder : public Order {
 public:
     AirliftOrder();
-    AirliftOrder(Player* issuer, Territory* source, Territory* target, int amount);
+    AirliftOrder(Player* issuer, Territory* source, Territory* target, ArmyCount amount);
     AirliftOrder(const AirliftOrder&);    
     Order* clone() const override;
 
     bool validate() const override;
     void execute() override;
     std::string name() const override;
+
+    Player* getIssuer() const;
+    Territory* getSource() const;
+    Territory* getTarget() const;
+    ArmyCount getAmount() const;
+
 private:
     Player* issuer_ = nullptr;
     Territory* source_ = nullptr;
     Territory* target_ = nullptr;
-    int amount_ = 0;
+    ArmyCount amount_ = 0;
 };
 
 class NegotiateOrder : public Order {
@@ -150,17 +207,32 @@ public:
     void execute() override;
     std::string name() const override;
 
+    Player* getIssuer() const;
+    Player* getOther() const;
+
 private:
     Player* issuer_ = nullptr;
     Player* other_ = nullptr;
 };
 
 // ======================= OrdersList =======================
+/**
+ * @brief Orders of one player, with an optional per-turn budget.
+ *
+ * @details With a budget, add() accepts at most that many orders between two beginTurn() calls
+ *          and refuses (deletes and counts) the rest. Strategies see the backpressure through
+ *          add()'s result and remaining(); the engine stops asking a player whose list isFull().
+ */
 class OrdersList : public ILoggable, public Subject {
 private:
     std::vector<Order*> orders; 
+    std::size_t budget = 0;         // orders accepted per turn, 0 = unlimited
+    std::size_t addedThisTurn = 0;  // orders accepted since beginTurn()
+    std::size_t dropped = 0;        // orders refused over the budget (all turns)
 
 public:
+    static const std::size_t UNLIMITED_BUDGET = 0;
+
     OrdersList() = default;
     ~OrdersList();
 
@@ -169,7 +241,7 @@ public:
     OrdersList(OrdersList&& other) noexcept;            
     OrdersList& operator=(OrdersList&& other) noexcept;  
 
-    void add(Order* o);
+    bool add(Order* o); // false if the order was refused (over the turn budget); a refused order is deleted
     void remove(int index);
     void move(int from, int to);
     void print() const;
@@ -180,6 +252,14 @@ public:
     Order* popfront();
     Order* popFirstByName(const std::string& name);
     const std::vector<Order*>& getOrders() const;
+
+    // Per-turn order budget (backpressure for strategies)
+    void setBudget(std::size_t maxOrdersPerTurn); // UNLIMITED_BUDGET to remove it
+    std::size_t getBudget() const;
+    void beginTurn(); // a new turn: the budget is available again
+    std::size_t remaining() const; // orders add() still accepts this turn (SIZE_MAX when unlimited)
+    bool isFull() const;
+    std::size_t getDropped() const;
     // ILoggable interface implementation
     std::string stringToLog() const override;
 
@@ -0,0 +1,116 @@
+/**
+ * @file PerfCounters.h
+ * @brief Per-phase performance counters: hardware events where available, software otherwise.
+ *
+ * @details
+ *  Wall time alone does not say whether a phase got slower because it executes more
+ *  instructions, misses the caches more or was descheduled. PerfScope measures one call of a
+ *  phase and adds the difference of two counter readings to a PhaseProfile:
+ *   - PerfCounters::forThisThread() opens Linux perf events for the calling thread once
+ *     (cycles, instructions, cache misses and branch misses; task clock, page faults and context
+ *     switches). Counts of multiplexed events are scaled by their enabled/running times.
+ *   - Where perf events are unavailable (containers, virtual machines without a PMU, restrictive
+ *     `perf_event_paranoid`, non-Linux systems) the missing software values come from `getrusage`
+ *     and the hardware columns are reported as "n/a".
+ *  The engine profiles reinforcementPhase(), issueOrdersPhase(), executeOrdersPhase(), map loading
+ *  and Map::validate() when `GameEngine::setPhaseProfiling()` is on; profiles add up per game and
+ *  per tournament.
+ *
+ * @note Readings are per thread: a PerfScope must end on the thread it started on.
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/** @brief Best counters available to a thread (a profile keeps the weakest it was given) */
+enum class PerfSource { Hardware, Software, Rusage };
+
+/** @brief Profiled parts of the engine (NeighbourWalk: locality walks of `bench`) */
+enum class PerfPhase { Reinforcement, IssueOrders, ExecuteOrders, LoadMap, ValidateMap, NeighbourWalk };
+constexpr std::size_t PERF_PHASE_COUNT = 6;
+
+/**
+ * @brief Counter values: a cumulative reading, or the difference of two readings summed over calls.
+ */
+struct PerfSample {
+    int calls = 0;                      ///< Measured calls (0 in a reading)
+    double wallMs = 0.0;                ///< Steady-clock time
+    double cpuMs = 0.0;                 ///< Task clock, or user + system time from getrusage
+    std::uint64_t cycles = 0;           ///< Hardware: CPU cycles (user space)
+    std::uint64_t instructions = 0;     ///< Hardware: retired instructions (user space)
+    std::uint64_t cacheMisses = 0;      ///< Hardware: last-level cache misses
+    std::uint64_t branchMisses = 0;     ///< Hardware: mispredicted branches
+    std::uint64_t pageFaults = 0;       ///< Software event or getrusage
+    std::uint64_t contextSwitches = 0;  ///< Software event or getrusage (voluntary + involuntary)
+
+    PerfSample& operator+=(const PerfSample& other);
+};
+PerfSample operator-(const PerfSample& later, const PerfSample& earlier);
+
+/**
+ * @class PerfCounters
+ * @brief Counters of one thread, opened on first use and read with read().
+ */
+class PerfCounters {
+public:
+    static PerfCounters& forThisThread();
+
+    PerfSample read() const; // cumulative values for the calling thread
+    PerfSource getSource() const;
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const PerfCounters& counters);
+
+private:
+    PerfCounters();
+    ~PerfCounters();
+
+    enum Event { Cycles, Instructions, CacheMisses, BranchMisses, TaskClock, PageFaults, ContextSwitches, EVENT_COUNT };
+    std::array<int, EVENT_COUNT> fds; // perf event file descriptors, -1 if unavailable
+    PerfSource source;
+};
+
+/**
+ * @class PhaseProfile
+ * @brief Counter totals per phase, added up over calls, games and tournaments.
+ */
+class PhaseProfile {
+public:
+    void add(PerfPhase phase, const PerfSample& delta, PerfSource source);
+    const PerfSample& get(PerfPhase phase) const;
+    PerfSource getSource() const;
+    bool empty() const;
+    void clear();
+
+    PhaseProfile& operator+=(const PhaseProfile& other);
+    friend std::ostream& operator<<(std::ostream& os, const PhaseProfile& profile); // one line per phase
+
+private:
+    std::array<PerfSample, PERF_PHASE_COUNT> phases;
+    PerfSource source = PerfSource::Hardware;
+};
+
+/**
+ * @class PerfScope
+ * @brief Adds the counters of its lifetime to a phase of a profile (does nothing without a profile).
+ */
+class PerfScope {
+public:
+    PerfScope(PhaseProfile* profile, PerfPhase phase);
+    ~PerfScope();
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+private:
+    PhaseProfile* profile;
+    PerfPhase phase;
+    PerfSample start;
+};
+
+const char* perfPhaseToString(PerfPhase phase);
+const char* perfSourceToString(PerfSource source);
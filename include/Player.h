@@ -13,12 +13,17 @@
 #include <string>
 #include <ostream>
 #include <set>
+#include <cstdint>
+#include "TerritoryBitset.h"
 
 class Territory;
+class Continent;
 class Hand;
 class Order;
 class OrdersList;
 class PlayerStrategy;
+class DecisionBudget;
+class GameContext;
 
 class Player {
 public:
@@ -38,6 +43,8 @@ public:
 	void addPlayerTerritory(Territory* territory); //Adds to Player's Owned Territories
 	void removePlayerTerritory(Territory* territory); //Removes from Player's Owned Territories
     std::vector<Territory*> getOwnedTerritories() const; //Returns a vector containing every owned territory
+	const TerritoryBitset& getOwnedMask() const; //Ids of the owned territories (word-parallel set tests)
+	bool ownsContinent(const Continent& continent) const; //Owns every territory of the continent
 
 	void addNegotiatedPlayer(Player* p);
     void clearNegotiatedPlayers();
@@ -49,6 +56,7 @@ public:
 	bool issueOrder(Order* orderIssued); //Adds an Order to be issued
 	
 	bool issueOrder();
+	bool issueOrder(DecisionBudget& budget); //Anytime variant used by the engine under a time budget
 
 	int getReinforcementPool() const; //Getter for reinforcementPool
 	void setReinforcementPool(int newPool); //Setter for reinforcementPool
@@ -56,6 +64,7 @@ public:
 	void subtractFromReinforcementPool(int amt);
 
 	bool hasTerritories() const; //Checks if player has any territories
+	std::size_t getTerritoryCount() const; //Number of owned territories (no copy of the list)
 	bool hasOrders() const; //Checks if player has any orders
 	Order* popNextOrder() const; //Gets the next order to be executed
 	Order* checkNextOrder() const; //Removes and returns the next order to be executed
@@ -63,19 +72,26 @@ public:
 
 	void setPlayerStrategy(PlayerStrategy* strategy); // Setter for player strategy
 	PlayerStrategy* getPlayerStrategy() const; // Getter for player strategy
+	PlayerStrategy* releasePlayerStrategy(); // Gives up ownership of the strategy (e.g. back to a StrategyPool)
+
+	std::uint64_t getVersion() const; // Bumped by every change of territories, truces or pool
+
+	void setGameContext(GameContext* context); // Game the player takes part in (not owned)
+	GameContext* getGameContext() const; // nullptr outside of an engine game
 private:
 	std::string playerName; //Player's Name
 	Hand* playerHand; //Player's Hand
 	bool cardAwardedThisTurn; // Flag to track if a card was awarded this turn
 	std::vector<Territory*> ownedTerritories; //List of Territories currently owned by Player
+	TerritoryBitset ownedMask; //Ids of ownedTerritories, kept in sync with the list
 	std::set<Player*> negotiatedPlayers; // Players this player has negotiated with
 	OrdersList* orders_; //List of orders issued by Player
 	int reinforcementPool; //Number of armies in the reinforcement pool
 	PlayerStrategy *playerStrategy; // Player's strategy
+	std::uint64_t version; // Change counter of the state read by order validation
+	GameContext* context; // Neutral player, randomness and deck of the player's game (not owned, may be null)
 
 friend std::ostream& operator<<(std::ostream& os, const Player& player);
 };
 
-
-extern Player* neutralPlayer; //neutral player instance
 void testPlayers();
\ No newline at end of file
@@ -3,12 +3,45 @@
 #include <string>
 #include <iosfwd>
 #include <iostream>
+#include <chrono>
+#include "StrategyPlan.h"
 
 
 class Player;
 class Territory;
 class Order;
 
+// ======================= Decision Budget =======================
+
+/**
+ * @brief Time and/or iteration budget for one anytime decision
+ * The strategy calls step() once per unit of work (e.g. candidate examined, or once with the
+ * territory count for a full rebuild) and stops refining, returning its best choice so far,
+ * once step() returns false.
+ */
+class DecisionBudget {
+
+	public:
+		using Clock = std::chrono::steady_clock;
+		static const long UNLIMITED_ITERATIONS = -1;
+
+		DecisionBudget(); // unlimited budget
+		DecisionBudget(Clock::duration timeLimit, long maxIterations = UNLIMITED_ITERATIONS);
+
+		bool step(long units = 1); // counts units of work; false once the budget is exhausted
+		bool exhausted() const;
+		bool isUnlimited() const;
+		long getIterations() const;
+
+		friend std::ostream& operator<<(std::ostream& os, const DecisionBudget& budget);
+
+	private:
+		bool hasDeadline_;
+		Clock::time_point deadline_;
+		long maxIterations_;
+		long iterations_;
+};
+
 // ======================= Player Strategies =======================
 
 /**
@@ -24,9 +57,22 @@ class PlayerStrategy {
 		// Called at the start of each issuing-phase to allow strategies
 		// to reset per-round state (e.g., Cheater acts only once per round).
 		virtual void resetForNewRound() {}
+		// Called when a pooled strategy is reused for a new game: clears per-game state and
+		// detaches the strategy from its previous player. The default resets the round state.
+		virtual void resetForNewGame();
+		// Name the strategy is registered under in the StrategyRegistry.
+		virtual const char* getStrategyName() const = 0;
+		// Opening book opt-in: strategies whose early turns are a pure function of the board
+		// return a stable id here; nullptr (the default) keeps them out of the book.
+		virtual const char* openingBookId() const;
 		
 		virtual bool issueOrder() = 0;
         virtual bool issueOrder(Order* orderIssued) = 0;
+		// Anytime variant: issue the best order found within the budget.
+		// The default calls issueOrder(): enough for decisions that take constant time (Neutral).
+		virtual bool issueOrderWithin(DecisionBudget& budget);
+		// Interactive strategies wait on the user and are exempt from engine time budgets.
+		virtual bool isInteractive() const;
 		virtual std::vector<Territory*> toAttack() = 0;
 		virtual std::vector<Territory*> toDefend() = 0;
 
@@ -52,11 +98,13 @@ class HumanPlayerStrategy : public PlayerStrategy {
 		HumanPlayerStrategy();
 		~HumanPlayerStrategy() override;
 		PlayerStrategy* clone() const override;
+		const char* getStrategyName() const override;
 		
 		bool issueOrder() override;
 		bool issueOrder(Order* orderIssued) override;
 		std::vector<Territory*> toAttack() override;
 		std::vector<Territory*> toDefend() override;
+		bool isInteractive() const override;
 
 		HumanPlayerStrategy(const HumanPlayerStrategy& other);
 		HumanPlayerStrategy& operator=(const HumanPlayerStrategy& other); 
@@ -73,11 +121,16 @@ class AggressivePlayerStrategy : public PlayerStrategy {
 		AggressivePlayerStrategy();
 		~AggressivePlayerStrategy() override;
 		PlayerStrategy* clone() const override;
+		const char* getStrategyName() const override;
 
 		bool issueOrder() override;
 		bool issueOrder(Order* orderIssued) override;
+		bool issueOrderWithin(DecisionBudget& budget) override;
 		std::vector<Territory*> toAttack() override;
 		std::vector<Territory*> toDefend() override;
+		const char* openingBookId() const override;
+		void resetForNewGame() override;
+		const StrategyPlan& getPlan() const;
 
         AggressivePlayerStrategy(const AggressivePlayerStrategy& other);
         AggressivePlayerStrategy& operator=(const AggressivePlayerStrategy& other);
@@ -85,10 +138,13 @@ class AggressivePlayerStrategy : public PlayerStrategy {
     private:
         // Helper methods for issueOrder()
         bool deployToStrongest();
-        bool attackAdjacentEnemies();
-        bool consolidateToStrongest();
+        bool attackAdjacentEnemies(DecisionBudget& budget, Territory*& consolidationSource);
+        bool consolidateToStrongest(Territory* source);
         friend std::ostream& operator<<(std::ostream& os, const AggressivePlayerStrategy& ps);
 
+        // Staging order and attack targets kept across turns (never copied: rebuilt on demand)
+        StrategyPlan plan_;
+
 };
 
 /**
@@ -102,9 +158,11 @@ class BenevolentPlayerStrategy : public PlayerStrategy {
 		BenevolentPlayerStrategy();
 		~BenevolentPlayerStrategy() override;
 		PlayerStrategy* clone() const override;
+		const char* getStrategyName() const override;
 
 		bool issueOrder() override;
 		bool issueOrder(Order* orderIssued) override;
+		bool issueOrderWithin(DecisionBudget& budget) override;
 		std::vector<Territory*> toAttack() override;
 		std::vector<Territory*> toDefend() override;
 
@@ -131,6 +189,7 @@ class NeutralPlayerStrategy : public PlayerStrategy {
 		NeutralPlayerStrategy();
 		~NeutralPlayerStrategy() override;
 		PlayerStrategy* clone() const override;
+		const char* getStrategyName() const override;
 
 		bool issueOrder() override;
 		bool issueOrder(Order* orderIssued) override;
@@ -152,9 +211,11 @@ class CheaterPlayerStrategy : public PlayerStrategy {
 		CheaterPlayerStrategy();
 		~CheaterPlayerStrategy() override;
 		PlayerStrategy* clone() const override;
+		const char* getStrategyName() const override;
 
 		bool issueOrder() override;
 		bool issueOrder(Order* orderIssued) override;
+		bool issueOrderWithin(DecisionBudget& budget) override;
 		std::vector<Territory*> toAttack() override;
 		std::vector<Territory*> toDefend() override;
 
@@ -0,0 +1,89 @@
+/**
+ * @file StrategyPlan.h
+ * @brief Persistent, incrementally invalidated plan of a bot strategy.
+ *
+ * @details
+ *  A strategy used to rebuild its whole intent on every `issueOrder()` call (sort every owned
+ *  territory, rescan every neighbourhood), although only a few territories change per turn.
+ *  A StrategyPlan keeps that intent across turns:
+ *   - the owned territories ordered strongest first (staging areas),
+ *   - for each owned territory, its weakest adjacent enemy (attack target).
+ *
+ *  The plan listens to the territories it depends on (owned territories and their neighbours).
+ *  When order execution conquers a territory or changes armies, only the affected entries are
+ *  reordered or marked stale; stale targets are recomputed on the next query. Decision cost per
+ *  turn therefore follows board churn, not board size.
+ *
+ * @note The plan rebuilds itself from scratch when it is attached to another player or when the
+ *       player's territory count no longer matches (e.g. after `gamestart` dealt the territories).
+ */
+
+#pragma once
+#include <cstddef>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <iosfwd>
+#include "Map.h"
+
+class Player;
+
+/**
+ * @brief Owned territories by strength and cached attack targets of one player.
+ */
+class StrategyPlan : public TerritoryListener {
+public:
+    StrategyPlan();
+    ~StrategyPlan() override;
+
+    bool attach(Player* player); // rebuild if the player changed or the plan is out of sync; true if rebuilt
+    void clear(); // stop listening and forget everything
+
+    Territory* strongest() const; // nullptr if the player owns nothing
+    std::vector<Territory*> strongestFirst() const;
+    std::size_t getOwnedCount() const;
+    // Visit the owned territories strongest first, without copying them, until visit returns false
+    template <typename Visit>
+    void forEachStrongestFirst(Visit visit) const {
+        for (const StrengthKey& key : owned) {
+            if (!visit(std::get<2>(key))) return;
+        }
+    }
+    Territory* weakestEnemyOf(Territory* source); // recomputed only if stale; nullptr if none
+
+    std::size_t getRebuilds() const;
+    std::size_t getTargetsRecomputed() const;
+    std::size_t getTargetsReused() const;
+
+    void territoryChanged(const Territory& territory, Player* previousOwner, ArmyCount previousArmies) override;
+    void territoryDestroyed(const Territory& territory) override;
+
+    StrategyPlan(const StrategyPlan&) = delete;
+    StrategyPlan& operator=(const StrategyPlan&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const StrategyPlan& plan);
+
+private:
+    // Strongest first: more armies first, then lower id
+    using StrengthKey = std::tuple<ArmyCount, int, Territory*>; // (-armies, id, territory)
+
+    struct Target {
+        Territory* enemy = nullptr;
+        bool stale = true;
+    };
+
+    void rebuild();
+    void listenTo(Territory* territory);
+    void addOwned(Territory* territory);
+    void removeOwned(Territory* territory, ArmyCount armies);
+    void invalidateAround(const Territory* territory);
+
+    Player* player;
+    std::set<StrengthKey> owned;
+    std::unordered_map<const Territory*, Target> targets;
+    std::unordered_set<Territory*> listened;
+    std::size_t rebuilds;
+    std::size_t targetsRecomputed;
+    std::size_t targetsReused;
+};
@@ -0,0 +1,80 @@
+/**
+ * @file StrategyRegistry.h
+ * @brief Name-to-factory registry of player strategies, and pools of reusable strategy objects.
+ *
+ * @details
+ *  - StrategyRegistry: maps a strategy name ("Aggressive", "Benevolent", ...) to a factory in O(1).
+ *    The built-in strategies are registered on first use; new strategies register under their
+ *    `PlayerStrategy::getStrategyName()`.
+ *  - StrategyPool: keeps strategy objects released at the end of a game and hands them out again,
+ *    reset through `PlayerStrategy::resetForNewGame()`, instead of allocating new ones per game.
+ *
+ * @note A pool is not thread-safe: use one pool per tournament worker. The registry is only
+ *       written while registering strategies, before games run.
+ */
+
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <iosfwd>
+#include <cstddef>
+
+class PlayerStrategy;
+
+/**
+ * @brief Registry of strategy factories, looked up by strategy name.
+ */
+class StrategyRegistry {
+public:
+    using Factory = PlayerStrategy* (*)();
+
+    static StrategyRegistry& instance(); // registry with the built-in strategies
+
+    bool registerStrategy(const std::string& name, Factory factory, bool interactive = false);
+    PlayerStrategy* create(const std::string& name) const; // new strategy, or nullptr if unknown
+    bool contains(const std::string& name) const;
+    bool isInteractive(const std::string& name) const; // waits on the user (not allowed in tournaments)
+    std::vector<std::string> getNames() const; // sorted
+
+    StrategyRegistry(const StrategyRegistry&) = delete;
+    StrategyRegistry& operator=(const StrategyRegistry&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const StrategyRegistry& registry);
+
+private:
+    StrategyRegistry();
+
+    struct Entry {
+        Factory factory;
+        bool interactive;
+    };
+    std::unordered_map<std::string, Entry> entries;
+};
+
+/**
+ * @brief Pool of strategy objects reused across the games of one worker.
+ *
+ * @details acquire() transfers ownership to the caller (normally a Player); release() takes it
+ *          back. Strategies still pooled when the pool is destroyed are deleted.
+ */
+class StrategyPool {
+public:
+    StrategyPool();
+    ~StrategyPool();
+
+    PlayerStrategy* acquire(const std::string& name); // pooled or new strategy, nullptr if unknown
+    void release(PlayerStrategy* strategy); // resets the strategy and keeps it (nullptr is ignored)
+
+    std::size_t getCreated() const;
+    std::size_t getReused() const;
+    std::size_t getPooled() const; // strategies currently waiting in the pool
+
+    StrategyPool(const StrategyPool&) = delete;
+    StrategyPool& operator=(const StrategyPool&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const StrategyPool& pool);
+
+private:
+    std::unordered_map<std::string, std::vector<PlayerStrategy*>> available;
+    std::size_t created;
+    std::size_t reused;
+};
@@ -0,0 +1,57 @@
+/**
+ * @file TerritoryBitset.h
+ * @brief Dense set of territory ids with word-parallel set algebra.
+ *
+ * @details
+ *  Territory ids are small consecutive integers (assigned by the map loader), so a set of
+ *  territories fits in a bitset of 64-bit words, bit `id` standing for the territory with that id.
+ *  Set operations then touch a word per 64 territories instead of a pointer per territory:
+ *   - Player keeps the set of territories it owns (getOwnedMask()),
+ *   - Territory keeps the set of its neighbours (getNeighbourMask()),
+ *   - Continent keeps the set of its member territories (getTerritoryMask()),
+ *  so "owns the whole continent" is `continent ⊆ owned`, "borders an owned territory" is one
+ *  intersection, and "already listed" during a neighbour scan is a bit test.
+ *
+ *  Neighbour and continent masks are kept for ids below MAX_MASKED_ID (small and medium maps); a
+ *  territory or continent with a member beyond it reports an incomplete mask and callers fall back
+ *  to the pointer lists.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <iosfwd>
+
+/**
+ * @class TerritoryBitset
+ * @brief Growable bitset indexed by territory id.
+ */
+class TerritoryBitset {
+public:
+    static const int MAX_MASKED_ID = 4096; ///< Ids covered by neighbour/continent masks (512 bytes each)
+
+    TerritoryBitset() = default;
+
+    void set(int id);   // grows the set as needed; negative ids are ignored
+    void reset(int id);
+    bool test(int id) const;
+    void clear();
+
+    bool any() const;
+    std::size_t count() const;
+    bool intersects(const TerritoryBitset& other) const; // (this & other) != 0
+    bool isSubsetOf(const TerritoryBitset& other) const; // (this & ~other) == 0
+
+    TerritoryBitset& operator|=(const TerritoryBitset& other);
+    TerritoryBitset& operator&=(const TerritoryBitset& other);
+    TerritoryBitset& subtract(const TerritoryBitset& other); // this &= ~other
+
+    std::vector<int> ids() const; // members in increasing id order
+
+    friend bool operator==(const TerritoryBitset& a, const TerritoryBitset& b);
+    friend std::ostream& operator<<(std::ostream& os, const TerritoryBitset& set);
+
+private:
+    std::vector<std::uint64_t> words;
+};
@@ -0,0 +1,103 @@
+/**
+ * @file TournamentProgress.h
+ * @brief Progress counters of a running tournament and a background reporter for them.
+ *
+ * @details
+ *  A tournament of M maps x G games can run for hours, and the per-turn console output says
+ *  nothing about how far along it is. The engine feeds a TournamentProgress while it plays:
+ *   - gameStarted() / gameFinished() around every game (which measures its duration),
+ *   - turnCompleted() at the end of every turn.
+ *  Each call is a few relaxed atomic updates: the simulation never takes a lock for it.
+ *
+ *  snapshot() turns the counters into games completed, running and queued, games and turns per
+ *  second, the average game duration of every map and an ETA (remaining games of each map times
+ *  that map's average, or the tournament average for maps not started yet). It may be called from
+ *  any thread, e.g. by a dashboard.
+ *
+ *  startReporting() runs a reporter thread that prints one line per interval to stderr, or
+ *  replaces the contents of a status file with it (written aside, then renamed, so a reader never
+ *  sees a partial line). The reporter only reads the atomics.
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Progress of a tournament at one point in time (see TournamentProgress::snapshot())
+ */
+struct TournamentProgressSnapshot {
+    std::size_t gamesTotal = 0;       ///< M x G
+    std::size_t gamesCompleted = 0;
+    std::size_t gamesRunning = 0;
+    std::size_t gamesQueued = 0;      ///< Not started yet
+    std::uint64_t turnsCompleted = 0; ///< Turns played by every game so far
+    double elapsedSeconds = 0.0;
+    double gamesPerSecond = 0.0;
+    double turnsPerSecond = 0.0;
+    double etaSeconds = -1.0;         ///< Remaining time estimate, -1 until a game has finished
+    std::vector<std::string> mapNames;
+    std::vector<double> mapAverageSeconds; ///< Average game duration per map, 0 if none finished
+    int currentMap = -1;              ///< Map of the running game, -1 if none
+};
+std::ostream& operator<<(std::ostream& os, const TournamentProgressSnapshot& snapshot); // one line
+
+/**
+ * @class TournamentProgress
+ * @brief Lock-free counters of a tournament, optionally reported by a background thread.
+ */
+class TournamentProgress {
+public:
+    TournamentProgress(const std::vector<std::string>& mapNames, int gamesPerMap);
+    ~TournamentProgress(); // stops the reporter (which prints a last line)
+
+    // Simulation side
+    void gameStarted(std::size_t map);
+    void gameFinished(std::size_t map);
+    void turnCompleted();
+
+    TournamentProgressSnapshot snapshot() const; // any thread
+
+    // Reporter: one line per interval to stderr (empty path) or into a status file
+    void startReporting(std::chrono::milliseconds interval, const std::string& statusPath = "");
+    void stopReporting();
+
+    TournamentProgress(const TournamentProgress&) = delete;
+    TournamentProgress& operator=(const TournamentProgress&) = delete;
+    friend std::ostream& operator<<(std::ostream& os, const TournamentProgress& progress);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::int64_t microsecondsSinceStart() const;
+    void report(); // reporter thread
+    void emit(const TournamentProgressSnapshot& snapshot) const;
+
+    const std::vector<std::string> mapNames;
+    const int gamesPerMap;
+    const Clock::time_point start;
+
+    std::atomic<std::size_t> started;
+    std::atomic<std::size_t> completed;
+    std::atomic<std::uint64_t> turns;
+    std::atomic<int> currentMap;                          // -1 between games
+    std::atomic<std::int64_t> currentGameStart;           // microseconds since start
+    std::vector<std::atomic<std::uint64_t>> mapMicroseconds; // summed game durations per map
+    std::vector<std::atomic<std::uint64_t>> mapGames;        // finished games per map
+
+    // Reporter thread; the simulation never touches these
+    std::mutex reporterMutex;
+    std::condition_variable wake;
+    bool stopping;
+    std::chrono::milliseconds interval;
+    std::string statusPath;
+    std::thread reporter;
+};
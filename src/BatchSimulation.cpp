@@ -0,0 +1,321 @@
+/**
+ * @file BatchSimulation.cpp
+ * @brief Lockstep multi-game kernels (see BatchSimulation.h for the layout and the bot rules).
+ */
+
+#include "../include/BatchSimulation.h"
+#include "../include/Map.h"
+#include "../include/GameRules.h"
+#include "../include/BattleResolver.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    const char* const BOT_NAMES[] = {"Aggressive", "Benevolent", "Neutral", "Cheater"};
+    const int BOT_COUNT = 4;
+
+    int botIndex(const std::string& strategy) {
+        for (int b = 0; b < BOT_COUNT; ++b) {
+            if (strategy == BOT_NAMES[b]) return b;
+        }
+        return -1;
+    }
+}
+
+/**
+ * @brief Build the shared topology and deal K independent games
+ * @param map Loaded (and validated) map
+ * @param strategies One bot name per player (2 to 4, see supports())
+ * @param games Number of lanes K
+ * @param seed Seed of the per-game random engines (lane g uses seed + g, like a GameContext)
+ * @throws std::invalid_argument on an empty map, an unsupported strategy or a bad player/game count
+ */
+BatchSimulation::BatchSimulation(const Map& map, const std::vector<std::string>& strategies, int games, std::uint64_t seed)
+    : territoryCount(static_cast<int>(map.getTerritories().size())),
+      lanes(games),
+      strategies(strategies),
+      turnsSimulated(0) {
+    if (territoryCount == 0) throw std::invalid_argument("BatchSimulation: the map has no territories.");
+    if (games < 1) throw std::invalid_argument("BatchSimulation: at least one game is required.");
+    if ((int)strategies.size() < MIN_PLAYERS || (int)strategies.size() > MAX_PLAYERS) {
+        throw std::invalid_argument("BatchSimulation: between 2 and 4 players are supported.");
+    }
+    for (const std::string& s : strategies) {
+        if (!supports(s)) throw std::invalid_argument("BatchSimulation: unsupported strategy " + s + ".");
+    }
+
+    const std::vector<Territory*>& territories = map.getTerritories();
+    std::unordered_map<const Territory*, int> indexOf;
+    indexOf.reserve(territories.size());
+    for (int t = 0; t < territoryCount; ++t) indexOf[territories[t]] = t;
+
+    adjacencyOffsets.reserve(territoryCount + 1);
+    adjacencyOffsets.push_back(0);
+    for (const Territory* t : territories) {
+        for (const Territory* adj : t->getAdjacents()) {
+            auto it = indexOf.find(adj);
+            if (it != indexOf.end()) adjacency.push_back(it->second);
+        }
+        adjacencyOffsets.push_back(static_cast<int>(adjacency.size()));
+    }
+
+    continentOffsets.push_back(0);
+    for (const Continent* c : map.getContinents()) {
+        for (const Territory* t : c->getTerritories()) {
+            auto it = indexOf.find(t);
+            if (it != indexOf.end()) continentMembers.push_back(it->second);
+        }
+        continentOffsets.push_back(static_cast<int>(continentMembers.size()));
+        continentBonus.push_back(c->getBonus());
+    }
+
+    setup(seed);
+}
+
+bool BatchSimulation::supports(const std::string& strategy) {
+    return botIndex(strategy) >= 0;
+}
+
+/** @brief Deal the territories round-robin in map order, as gamestart does, and shuffle the seats per lane */
+void BatchSimulation::setup(std::uint64_t seed) {
+    const int players = static_cast<int>(strategies.size());
+    const std::size_t cells = static_cast<std::size_t>(territoryCount) * lanes;
+
+    owner.assign(cells, -1);
+    armies.assign(cells, 0);
+    marked.assign(cells, 0);
+    bot.assign(static_cast<std::size_t>(players) * lanes, 0);
+    reserve.assign(static_cast<std::size_t>(players) * lanes, ActiveRules::startingArmies());
+    seating.assign(static_cast<std::size_t>(players) * lanes, 0);
+    running.assign(lanes, 1);
+    winner.assign(lanes, -1);
+    me.assign(lanes, 0);
+    acting.assign(lanes, 0);
+    chosen.assign(lanes, -1);
+    chosenArmies.assign(lanes, 0);
+
+    for (int t = 0; t < territoryCount; ++t) {
+        std::fill_n(&owner[static_cast<std::size_t>(t) * lanes], lanes, static_cast<std::int8_t>(t % players));
+    }
+
+    rngs.clear();
+    rngs.reserve(lanes);
+    std::vector<int> seats(players);
+    for (int g = 0; g < lanes; ++g) {
+        rngs.emplace_back(seed + static_cast<std::uint64_t>(g));
+        std::mt19937_64& rng = rngs.back();
+
+        std::iota(seats.begin(), seats.end(), 0);
+        std::shuffle(seats.begin(), seats.end(), rng);
+        for (int s = 0; s < players; ++s) {
+            seating[static_cast<std::size_t>(s) * lanes + g] = static_cast<std::int8_t>(seats[s]);
+        }
+        for (int p = 0; p < players; ++p) {
+            bot[static_cast<std::size_t>(p) * lanes + g] = static_cast<std::uint8_t>(botIndex(strategies[p]));
+        }
+    }
+}
+
+/**
+ * @brief Play up to maxTurns turns in every lane
+ * @param maxTurns Turn limit after which undecided games are draws
+ * @return Strategy name of the winner of each game, or "Draw"
+ */
+std::vector<std::string> BatchSimulation::run(int maxTurns) {
+    const int players = static_cast<int>(strategies.size());
+    for (int turn = 0; turn < maxTurns; ++turn) {
+        if (std::find(running.begin(), running.end(), 1) == running.end()) break;
+        for (int seat = 0; seat < players; ++seat) {
+            selectSeat(seat);
+            reinforce();
+            deploy();
+            attack();
+            cheat();
+        }
+        updateWinners();
+        ++turnsSimulated;
+    }
+
+    std::vector<std::string> results(lanes, "Draw");
+    for (int g = 0; g < lanes; ++g) {
+        if (winner[g] >= 0) results[g] = strategies[winner[g]];
+    }
+    return results;
+}
+
+/** @brief Load the player of a seat in every lane; lanes whose game ended do not act */
+void BatchSimulation::selectSeat(int seat) {
+    const std::int8_t* seated = &seating[static_cast<std::size_t>(seat) * lanes];
+    for (int g = 0; g < lanes; ++g) {
+        me[g] = seated[g];
+        acting[g] = running[g];
+    }
+}
+
+/** @brief Territory income (and continent bonuses) added to each acting player's pool */
+void BatchSimulation::reinforce() {
+    std::vector<ArmyCount>& owned = chosenArmies; // scratch: territory count per lane
+    std::fill(owned.begin(), owned.end(), 0);
+    for (int t = 0; t < territoryCount; ++t) {
+        const std::int8_t* o = &owner[static_cast<std::size_t>(t) * lanes];
+        for (int g = 0; g < lanes; ++g) owned[g] += (o[g] == me[g]);
+    }
+    for (int g = 0; g < lanes; ++g) {
+        const int income = owned[g] ? GameRules::baseReinforcement<ActiveRules>(static_cast<int>(owned[g])) : 0;
+        reserve[static_cast<std::size_t>(me[g]) * lanes + g] += acting[g] ? income : 0;
+    }
+
+    std::vector<std::uint8_t>& holdsAll = marked; // scratch: first `lanes` cells
+    for (std::size_t c = 0; c < continentBonus.size(); ++c) {
+        if (continentOffsets[c] == continentOffsets[c + 1]) continue; // empty continent: no bonus
+        std::fill(holdsAll.begin(), holdsAll.begin() + lanes, 1);
+        for (int i = continentOffsets[c]; i < continentOffsets[c + 1]; ++i) {
+            const std::int8_t* o = &owner[static_cast<std::size_t>(continentMembers[i]) * lanes];
+            for (int g = 0; g < lanes; ++g) holdsAll[g] &= (o[g] == me[g]);
+        }
+        for (int g = 0; g < lanes; ++g) {
+            reserve[static_cast<std::size_t>(me[g]) * lanes + g] += (acting[g] & holdsAll[g]) ? continentBonus[c] : 0;
+        }
+    }
+    std::fill(holdsAll.begin(), holdsAll.begin() + lanes, 0);
+}
+
+/** @brief Aggressive deploys on its strongest territory, Benevolent on its weakest */
+void BatchSimulation::deploy() {
+    std::vector<std::uint8_t> strongest(lanes);
+    for (int g = 0; g < lanes; ++g) {
+        const std::uint8_t b = bot[static_cast<std::size_t>(me[g]) * lanes + g];
+        strongest[g] = (b == Aggressive);
+        acting[g] &= (b == Aggressive || b == Benevolent);
+        chosen[g] = -1;
+        chosenArmies[g] = strongest[g] ? std::numeric_limits<ArmyCount>::min() : std::numeric_limits<ArmyCount>::max();
+    }
+
+    for (int t = 0; t < territoryCount; ++t) {
+        const std::int8_t* o = &owner[static_cast<std::size_t>(t) * lanes];
+        const ArmyCount* a = &armies[static_cast<std::size_t>(t) * lanes];
+        for (int g = 0; g < lanes; ++g) {
+            const bool better = strongest[g] ? a[g] > chosenArmies[g] : a[g] < chosenArmies[g];
+            const bool take = (o[g] == me[g]) & better;
+            chosen[g] = take ? t : chosen[g];
+            chosenArmies[g] = take ? a[g] : chosenArmies[g];
+        }
+    }
+
+    for (int g = 0; g < lanes; ++g) {
+        if (!acting[g] || chosen[g] < 0) continue;
+        int& pool = reserve[static_cast<std::size_t>(me[g]) * lanes + g];
+        ArmyCount& target = armies[static_cast<std::size_t>(chosen[g]) * lanes + g];
+        target = Armies::add(target, pool);
+        pool = 0;
+    }
+
+    for (int g = 0; g < lanes; ++g) acting[g] = running[g];
+}
+
+/** @brief Aggressive bots attack the weakest adjacent enemy from every territory with spare armies */
+void BatchSimulation::attack() {
+    for (int g = 0; g < lanes; ++g) {
+        acting[g] &= (bot[static_cast<std::size_t>(me[g]) * lanes + g] == Aggressive);
+    }
+
+    for (int t = 0; t < territoryCount; ++t) {
+        const std::size_t source = static_cast<std::size_t>(t) * lanes;
+        for (int g = 0; g < lanes; ++g) {
+            chosen[g] = -1;
+            chosenArmies[g] = std::numeric_limits<ArmyCount>::max();
+        }
+
+        // Weakest enemy neighbour of t, in every lane where t is an eligible source
+        for (int i = adjacencyOffsets[t]; i < adjacencyOffsets[t + 1]; ++i) {
+            const int n = adjacency[i];
+            const std::int8_t* o = &owner[static_cast<std::size_t>(n) * lanes];
+            const ArmyCount* a = &armies[static_cast<std::size_t>(n) * lanes];
+            for (int g = 0; g < lanes; ++g) {
+                const bool eligible = acting[g] & (owner[source + g] == me[g]) & (armies[source + g] > 1);
+                const bool take = eligible & (o[g] >= 0) & (o[g] != me[g]) & (a[g] < chosenArmies[g]);
+                chosen[g] = take ? n : chosen[g];
+                chosenArmies[g] = take ? a[g] : chosenArmies[g];
+            }
+        }
+
+        // Battles diverge per lane (random lengths): resolved lane by lane, one battle seed each
+        for (int g = 0; g < lanes; ++g) {
+            if (chosen[g] < 0) continue;
+            const std::size_t target = static_cast<std::size_t>(chosen[g]) * lanes + g;
+            const int defenderPlayer = owner[target];
+            std::uint8_t& defenderBot = bot[static_cast<std::size_t>(defenderPlayer) * lanes + g];
+            if (defenderBot == Neutral) defenderBot = Aggressive;
+
+            ArmyCount attackers = armies[source + g] - 1;
+            ArmyCount defenders = armies[target];
+            armies[source + g] = 1;
+            GameRules::resolveBattleSeeded<ActiveRules>(attackers, defenders, rngs[g]());
+            if (defenders == 0) {
+                owner[target] = static_cast<std::int8_t>(me[g]);
+                armies[target] = attackers;
+            } else {
+                armies[target] = defenders;
+            }
+        }
+    }
+
+    for (int g = 0; g < lanes; ++g) acting[g] = running[g];
+}
+
+/** @brief Cheaters take every enemy territory adjacent to one they owned at the start of the step */
+void BatchSimulation::cheat() {
+    for (int g = 0; g < lanes; ++g) {
+        acting[g] &= (bot[static_cast<std::size_t>(me[g]) * lanes + g] == Cheater);
+    }
+    if (std::find(acting.begin(), acting.end(), 1) == acting.end()) return;
+
+    for (int t = 0; t < territoryCount; ++t) {
+        const std::size_t cell = static_cast<std::size_t>(t) * lanes;
+        for (int g = 0; g < lanes; ++g) marked[cell + g] = 0;
+        for (int i = adjacencyOffsets[t]; i < adjacencyOffsets[t + 1]; ++i) {
+            const std::int8_t* o = &owner[static_cast<std::size_t>(adjacency[i]) * lanes];
+            for (int g = 0; g < lanes; ++g) marked[cell + g] |= (o[g] == me[g]);
+        }
+        for (int g = 0; g < lanes; ++g) marked[cell + g] &= acting[g] & (owner[cell + g] != me[g]);
+    }
+    for (std::size_t cell = 0; cell < owner.size(); ++cell) {
+        const int g = static_cast<int>(cell % lanes);
+        if (!marked[cell]) continue;
+        owner[cell] = static_cast<std::int8_t>(me[g]);
+        armies[cell] = 1;
+        marked[cell] = 0;
+    }
+}
+
+/** @brief A lane is decided once one player owns every territory */
+void BatchSimulation::updateWinners() {
+    std::vector<std::uint8_t> sole(lanes, 1);
+    const std::int8_t* first = &owner[0];
+    for (int t = 1; t < territoryCount; ++t) {
+        const std::int8_t* o = &owner[static_cast<std::size_t>(t) * lanes];
+        for (int g = 0; g < lanes; ++g) sole[g] &= (o[g] == first[g]);
+    }
+    for (int g = 0; g < lanes; ++g) {
+        if (running[g] && sole[g] && first[g] >= 0) {
+            winner[g] = first[g];
+            running[g] = 0;
+        }
+    }
+}
+
+int BatchSimulation::getGameCount() const { return lanes; }
+int BatchSimulation::getTerritoryCount() const { return territoryCount; }
+long BatchSimulation::getTurnsSimulated() const { return turnsSimulated; }
+
+std::ostream& operator<<(std::ostream& os, const BatchSimulation& batch) {
+    int decided = 0;
+    for (std::int8_t w : batch.winner) decided += (w >= 0);
+    os << "BatchSimulation [games: " << batch.lanes << ", territories: " << batch.territoryCount
+       << ", turns: " << batch.turnsSimulated << ", decided: " << decided << "]";
+    return os;
+}
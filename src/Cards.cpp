@@ -232,16 +232,22 @@ std::ostream & operator << (std::ostream &os, const Deck &deck) {
 
 
 
-// To Draw a card from the Deck and place it in Hand.
+// To Draw a card from the Deck and place it in Hand (one random engine per thread).
 std::string Deck::draw(Hand &hand) {
+    thread_local std::mt19937_64 random(std::random_device{}());
+    return draw(hand, random);
+}
+
+// To Draw a card from the Deck with the given random engine and place it in Hand.
+std::string Deck::draw(Hand &hand, std::mt19937_64 &random) {
     Card* cardDrawn = nullptr;
     std::string cardDrawnString = "";
     
     if(cardsOnDeck.size() > 0) {
 
          //Generating a random index and drawing the card from that index.
-        srand(time(0));
-        int randomIndex = rand() % cardsOnDeck.size();
+        std::uniform_int_distribution<std::size_t> index(0, cardsOnDeck.size() - 1);
+        std::size_t randomIndex = index(random);
         cardDrawn = cardsOnDeck.at(randomIndex);
 
         // Erase card after drawing it.
@@ -14,6 +14,8 @@
  
 #include "../include/GameEngine.h"
 #include "../include/CommandProcessing.h"
+#include "../include/MapIndex.h"
+#include "../include/StrategyRegistry.h"
 
 #include <iostream>
 #include <vector>
@@ -256,16 +258,12 @@ std::vector<int> CommandProcessor::validateTournament(const std::string& command
     std::vector<std::string> mapNames = extractMapOrPlayerOfTournament(command, listOfMapsIndex, listOfPlayerStratsIndex);
     std::size_t numOfMaps = mapNames.size();
 
-    // Check the maps entered to make sure they are valid/exist.
-    // (adapted from validateMapFileExists() because it's a private function in GameEngine.)
-    for(std::string mapStr : mapNames) {
-        std::string mapPath = "assets/maps/" + mapStr;
-        
-        std::ifstream fileCheck(mapPath);
-        bool exists = fileCheck.good();
-        fileCheck.close();
+    // Check the maps entered to make sure they exist and are valid, using the map index
+    // (no .map file is opened unless it changed since it was last indexed).
+    for(const std::string& mapStr : mapNames) {
+        const MapIndexEntry* entry = MapIndex::forDefaultDirectory().find(mapStr);
 
-        if(!exists) {
+        if(!entry || !entry->valid) {
             throw std::invalid_argument("One or more of the map name(s) entered is not valid. Please re-enter command.");
         }
     }
@@ -288,9 +286,9 @@ std::vector<int> CommandProcessor::validateTournament(const std::string& command
         
         std::string playerStrat = playerStratNames.at(i); // get player strategy entered.
     
-        // Check to see if the player strategy entered is a valid one. Else, throw error.
-        if(playerStrat == "Neutral" || playerStrat == "Cheater" || playerStrat == "Aggressive" || playerStrat == "Benevolent") {
-        } else {
+        // Check to see if the player strategy entered is a registered, non-interactive one. Else, throw error.
+        const StrategyRegistry& registry = StrategyRegistry::instance();
+        if(!registry.contains(playerStrat) || registry.isInteractive(playerStrat)) {
             throw std::invalid_argument("One or more of the player strategy(s) entered is not valid. Please re-enter command.");
         }
 
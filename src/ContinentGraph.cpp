@@ -0,0 +1,239 @@
+/**
+ * @file ContinentGraph.cpp
+ * @brief Continent graph construction, incremental summaries and planning queries.
+ */
+
+#include "../include/ContinentGraph.h"
+#include "../include/Player.h"
+#include <algorithm>
+#include <climits>
+#include <limits>
+#include <ostream>
+#include <queue>
+
+// ======================= ContinentNode =======================
+
+/** @brief Player holding every territory of the continent, or nullptr */
+Player* ContinentNode::soleOwner() const {
+    if (territories.empty() || holdings.size() != 1) return nullptr;
+    const ContinentHolding& h = holdings.front();
+    return h.territories == static_cast<int>(territories.size()) ? h.player : nullptr;
+}
+
+const ContinentHolding* ContinentNode::holdingOf(const Player* player) const {
+    for (const ContinentHolding& h : holdings) {
+        if (h.player == player) return &h;
+    }
+    return nullptr;
+}
+
+// ======================= ContinentGraph =======================
+
+/**
+ * @brief Build the graph of a loaded map and start listening to its territories
+ * @param map Map to abstract (not owned; must outlive the graph)
+ */
+ContinentGraph::ContinentGraph(Map& map) : map(&map) {
+    const std::vector<Continent*>& continents = map.getContinents();
+    nodes.resize(continents.size());
+    for (std::size_t c = 0; c < continents.size(); ++c) {
+        nodes[c].continent = continents[c];
+        continentIndex[continents[c]] = static_cast<int>(c);
+    }
+
+    for (Territory* t : map.getTerritories()) {
+        for (Continent* c : t->getContinents()) {
+            auto it = continentIndex.find(c);
+            if (it == continentIndex.end()) continue;
+            territoryContinent[t] = it->second; // a territory belongs to exactly one continent
+            nodes[it->second].territories.push_back(t);
+            break;
+        }
+    }
+
+    // Edges: for each border territory, record it on both sides of every continent pair it joins
+    for (ContinentNode& node : nodes) {
+        const int from = static_cast<int>(&node - nodes.data());
+        for (Territory* t : node.territories) {
+            for (Territory* adj : t->getAdjacents()) {
+                const int to = continentOf(adj);
+                if (to < 0 || to == from) continue;
+
+                auto edge = std::find_if(node.edges.begin(), node.edges.end(),
+                                         [to](const ContinentEdge& e) { return e.to == to; });
+                if (edge == node.edges.end()) {
+                    node.edges.push_back(ContinentEdge{to, {}, {}});
+                    edge = node.edges.end() - 1;
+                }
+                if (std::find(edge->borders.begin(), edge->borders.end(), t) == edge->borders.end()) {
+                    edge->borders.push_back(t);
+                }
+                if (std::find(edge->across.begin(), edge->across.end(), adj) == edge->across.end()) {
+                    edge->across.push_back(adj);
+                }
+            }
+        }
+    }
+
+    for (Territory* t : map.getTerritories()) t->addListener(this);
+    rebuild();
+}
+
+/** @brief Stop listening to the territories */
+ContinentGraph::~ContinentGraph() {
+    for (Territory* t : map->getTerritories()) t->removeListener(this);
+}
+
+/** @brief Recompute every node summary from the current owners and armies */
+void ContinentGraph::rebuild() {
+    for (ContinentNode& node : nodes) {
+        node.armies = 0;
+        node.holdings.clear();
+        for (Territory* t : node.territories) {
+            node.armies += t->getArmies();
+            adjust(node, t->getOwner(), 1, t->getArmies());
+        }
+    }
+}
+
+/** @brief Add territories/armies to a player's holding, dropping holdings that become empty */
+void ContinentGraph::adjust(ContinentNode& node, Player* player, int territories, ArmyCount armies) {
+    if (!player) return;
+    auto it = std::find_if(node.holdings.begin(), node.holdings.end(),
+                           [player](const ContinentHolding& h) { return h.player == player; });
+    if (it == node.holdings.end()) {
+        node.holdings.push_back(ContinentHolding{player, 0, 0});
+        it = node.holdings.end() - 1;
+    }
+    it->territories += territories;
+    it->armies += armies;
+    if (it->territories <= 0) node.holdings.erase(it);
+}
+
+/** @brief Incremental update: move the territory from its previous owner/armies to the current ones */
+void ContinentGraph::territoryChanged(const Territory& territory, Player* previousOwner, ArmyCount previousArmies) {
+    const int c = continentOf(&territory);
+    if (c < 0) return;
+    ContinentNode& node = nodes[c];
+    node.armies += territory.getArmies() - previousArmies;
+    adjust(node, previousOwner, -1, -previousArmies);
+    adjust(node, territory.getOwner(), 1, territory.getArmies());
+}
+
+const std::vector<ContinentNode>& ContinentGraph::getNodes() const { return nodes; }
+
+int ContinentGraph::indexOf(const Continent* continent) const {
+    auto it = continentIndex.find(continent);
+    return it == continentIndex.end() ? -1 : it->second;
+}
+
+int ContinentGraph::continentOf(const Territory* territory) const {
+    auto it = territoryContinent.find(territory);
+    return it == territoryContinent.end() ? -1 : it->second;
+}
+
+/** @brief Sum of the bonuses of the continents the player holds entirely */
+int ContinentGraph::continentBonus(const Player* player) const {
+    int bonus = 0;
+    for (const ContinentNode& node : nodes) {
+        if (player && node.soleOwner() == player) bonus += node.continent->getBonus();
+    }
+    return bonus;
+}
+
+/**
+ * @brief Continent the player can complete against the least resistance
+ * @param player Planning player
+ * @return Continent not yet held by the player, where it holds or borders territory, minimizing
+ *         enemy armies plus territories still to take (ties: higher bonus); nullptr if none
+ */
+Continent* ContinentGraph::cheapestToComplete(const Player* player) const {
+    Continent* best = nullptr;
+    ArmyCount bestCost = std::numeric_limits<ArmyCount>::max();
+    int bestBonus = INT_MIN;
+
+    for (const ContinentNode& node : nodes) {
+        if (node.territories.empty() || node.soleOwner() == player) continue;
+
+        const ContinentHolding* mine = node.holdingOf(player);
+        bool reachable = mine != nullptr;
+        for (std::size_t e = 0; !reachable && e < node.edges.size(); ++e) {
+            reachable = nodes[node.edges[e].to].holdingOf(player) != nullptr;
+        }
+        if (!reachable) continue;
+
+        const int ownTerritories = mine ? mine->territories : 0;
+        const ArmyCount ownArmies = mine ? mine->armies : 0;
+        const ArmyCount cost = node.armies - ownArmies + static_cast<ArmyCount>(node.territories.size()) - ownTerritories;
+        const int bonus = node.continent->getBonus();
+        if (cost < bestCost || (cost == bestCost && bonus > bestBonus)) {
+            best = node.continent;
+            bestCost = cost;
+            bestBonus = bonus;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Continents held entirely by the player whose borders touch enemy territories
+ * @details Coarse filter on the summaries, then a local check of the border lists only.
+ */
+std::vector<Continent*> ContinentGraph::underThreat(const Player* player) const {
+    std::vector<Continent*> threatened;
+    for (const ContinentNode& node : nodes) {
+        if (!player || node.soleOwner() != player) continue;
+
+        bool threat = false;
+        for (const ContinentEdge& edge : node.edges) {
+            if (nodes[edge.to].soleOwner() == player) continue; // neighbour is safe too
+            for (const Territory* t : edge.across) {
+                if (t->getOwner() && t->getOwner() != player) {
+                    threat = true;
+                    break;
+                }
+            }
+            if (threat) break;
+        }
+        if (threat) threatened.push_back(node.continent);
+    }
+    return threatened;
+}
+
+/**
+ * @brief Shortest chain of continents from one continent to another
+ * @return Continents from `from` to `to` inclusive; empty if either is unknown or unreachable
+ */
+std::vector<Continent*> ContinentGraph::path(const Continent* from, const Continent* to) const {
+    const int source = indexOf(from);
+    const int target = indexOf(to);
+    if (source < 0 || target < 0) return {};
+
+    std::vector<int> parent(nodes.size(), -1);
+    std::queue<int> frontier;
+    parent[source] = source;
+    frontier.push(source);
+    while (!frontier.empty() && parent[target] < 0) {
+        const int c = frontier.front();
+        frontier.pop();
+        for (const ContinentEdge& edge : nodes[c].edges) {
+            if (parent[edge.to] >= 0) continue;
+            parent[edge.to] = c;
+            frontier.push(edge.to);
+        }
+    }
+    if (parent[target] < 0) return {};
+
+    std::vector<Continent*> route;
+    for (int c = target; c != source; c = parent[c]) route.push_back(nodes[c].continent);
+    route.push_back(nodes[source].continent);
+    std::reverse(route.begin(), route.end());
+    return route;
+}
+
+std::ostream& operator<<(std::ostream& os, const ContinentGraph& graph) {
+    std::size_t edges = 0;
+    for (const ContinentNode& node : graph.nodes) edges += node.edges.size();
+    os << "ContinentGraph [continents: " << graph.nodes.size() << ", edges: " << edges / 2 << "]";
+    return os;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file GameContext.cpp
+ * @brief Per-game Neutral player, randomness, deck, log and metrics (see GameContext.h).
+ */
+
+#include <ostream>
+#include "../include/GameContext.h"
+#include "../include/Player.h"
+#include "../include/Cards.h"
+
+// ======================= OrderBudgetStats =======================
+
+/** @brief Add the backpressure of another game */
+OrderBudgetStats& OrderBudgetStats::operator+=(const OrderBudgetStats& other) {
+    limitedTurns += other.limitedTurns;
+    droppedOrders += other.droppedOrders;
+    return *this;
+}
+
+/** @brief Print e.g. "3 player turns reached the budget, 2 orders dropped" */
+std::ostream& operator<<(std::ostream& os, const OrderBudgetStats& stats) {
+    return os << stats.limitedTurns << " player turns reached the budget, " << stats.droppedOrders
+              << " orders dropped";
+}
+
+// ======================= GameContext Class =======================
+
+/** @brief Context of a new game, seeded from std::random_device */
+GameContext::GameContext() : GameContext((static_cast<std::uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}()) {}
+
+/**
+ * @brief Context of a new game
+ * @param seed Seed of the game's random engine (the same seed replays the same draws)
+ */
+GameContext::GameContext(std::uint64_t seed)
+    : neutralPlayer(nullptr),
+      seed(seed),
+      random(seed),
+      deck(new Deck()),
+      log(nullptr) {}
+
+/**
+ * @brief Copy the randomness, deck, log and metrics of another context
+ * @details The Neutral player is not copied: the territories it holds point to the original, as
+ *          the players of a copied GameEngine do. The copy creates its own when it needs one.
+ */
+GameContext::GameContext(const GameContext& other)
+    : neutralPlayer(nullptr),
+      seed(other.seed),
+      random(other.random),
+      deck(new Deck(*other.deck)),
+      log(other.log),
+      phaseProfile(other.phaseProfile),
+      orderBudgetStats(other.orderBudgetStats) {}
+
+GameContext::~GameContext() {
+    delete neutralPlayer;
+    delete deck;
+}
+
+GameContext& GameContext::operator=(const GameContext& other) {
+    if (this != &other) {
+        delete neutralPlayer;
+        neutralPlayer = nullptr; // see the copy constructor
+        *deck = *other.deck;
+        seed = other.seed;
+        random = other.random;
+        log = other.log;
+        phaseProfile = other.phaseProfile;
+        orderBudgetStats = other.orderBudgetStats;
+    }
+    return *this;
+}
+
+/**
+ * @brief Player that receives blockaded territories
+ * @details Created on the first Blockade. It has no strategy: it never issues orders, and an
+ *          attack on one of its territories does not turn it Aggressive.
+ */
+Player* GameContext::getNeutralPlayer() {
+    if (!neutralPlayer) neutralPlayer = new Player("Neutral");
+    return neutralPlayer;
+}
+
+bool GameContext::hasNeutralPlayer() const { return neutralPlayer != nullptr; }
+
+const Player* GameContext::getNeutralPlayerIfCreated() const { return neutralPlayer; }
+
+/** @brief Random engine of the game (player order, card draws) */
+std::mt19937_64& GameContext::getRandom() { return random; }
+
+const std::mt19937_64& GameContext::getRandom() const { return random; }
+
+std::uint64_t GameContext::getSeed() const { return seed; }
+
+/** @brief Seed of the next battle of the game */
+std::uint64_t GameContext::nextBattleSeed() { return random(); }
+
+Deck& GameContext::getDeck() { return *deck; }
+
+const Deck& GameContext::getDeck() const { return *deck; }
+
+void GameContext::setLog(Observer* observer) { log = observer; }
+
+Observer* GameContext::getLog() const { return log; }
+
+PhaseProfile& GameContext::getPhaseProfile() { return phaseProfile; }
+
+OrderBudgetStats& GameContext::getOrderBudgetStats() { return orderBudgetStats; }
+
+/** @brief Print e.g. "GameContext(seed 42, 50 cards on the deck, Neutral player: none)" */
+std::ostream& operator<<(std::ostream& os, const GameContext& context) {
+    os << "GameContext(seed " << context.seed << ", " << context.deck->getCardsOnDeck().size()
+       << " cards on the deck, Neutral player: ";
+    if (context.neutralPlayer) {
+        os << context.neutralPlayer->getTerritoryCount() << " territories";
+    } else {
+        os << "none";
+    }
+    return os << (context.log ? ", logged)" : ")");
+}
@@ -19,11 +19,25 @@
 #include "../include/Orders.h"
 #include "../include/Cards.h"
 #include "../include/CommandProcessing.h"
+#include "../include/OpeningBook.h"
+#include "../include/MapIndex.h"
+#include "../include/GameRules.h"
+#include "../include/StrategyRegistry.h"
+#include "../include/ContinentGraph.h"
+#include "../include/GameStateFile.h"
+#include "../include/OrderCoalescing.h"
+#include "../include/MapPrefetcher.h"
+#include "../include/TournamentProgress.h"
+#include "../include/BatchSimulation.h"
+#include "../include/MapWriter.h"
+#include "../include/PerfCounters.h"
 #include <iostream>
 #include <algorithm>
 #include <sstream>
 #include <random>
 #include <fstream>
+#include <filesystem>
+#include <unordered_map>
 
 // Importing only the neccessary std functions.
 using std::cout;
@@ -32,6 +46,13 @@ using std::ostream;
 using std::vector;
 using std::endl;
 
+// Opening book file shared across tournament runs (next to the maps it was recorded on)
+static const char* const OPENING_BOOK_PATH = "assets/opening.book";
+
+// Default time a bot may spend deciding its orders in one issue phase: unlimited, since a
+// wall-clock budget makes the orders (and the game) depend on the speed of the machine
+static const std::chrono::milliseconds DEFAULT_DECISION_TIME_BUDGET(0);
+
 
 // ======================= Command Class =======================
 
@@ -120,9 +141,25 @@ GameEngine::GameEngine()
     : currentState(new GameState(GameState::Start)),
       stateTransitions(nullptr),
       gameMap(new Map()),
+      continentGraph(nullptr),
       players(new vector<Player*>()),
       mapLoader(new MapLoader()),
-      deck(new Deck()) {
+      context(new GameContext()),
+      openingBook(nullptr),
+      strategyPool(nullptr),
+      stateFile(nullptr),
+      loadedMapName(new std::string()),
+      turnNumber(new int(0)),
+      lastTurn(new int(0)),
+      decisionTimeBudget(new std::chrono::milliseconds(DEFAULT_DECISION_TIME_BUDGET)),
+      orderCoalescing(new bool(false)),
+      territoryRenumbering(new bool(false)),
+      phaseProfiling(new bool(false)),
+      orderBudget(new std::size_t(OrdersList::UNLIMITED_BUDGET)),
+      progressInterval(new std::chrono::milliseconds(0)),
+      progressPath(new std::string()),
+      progress(nullptr),
+      batchTournament(new bool(false)) {
     initializeTransitions();
     cout << "GameEngine initialized in Start state." << endl;
 }
@@ -135,9 +172,25 @@ GameEngine::GameEngine(const GameEngine& other)
     : currentState(new GameState(*other.currentState)),
       stateTransitions(new TransitionMap(*other.stateTransitions)),
       gameMap(nullptr), // Map copying would require more complex logic
+      continentGraph(nullptr), // rebuilt on first use
       players(new vector<Player*>()),
       mapLoader(nullptr), 
-      deck(nullptr) {
+      context(new GameContext(*other.context)),
+      openingBook(other.openingBook), // shared, not owned
+      strategyPool(other.strategyPool), // shared, not owned
+      stateFile(nullptr), // a state file records the game of one engine
+      loadedMapName(new std::string(*other.loadedMapName)),
+      turnNumber(new int(*other.turnNumber)),
+      lastTurn(new int(*other.lastTurn)),
+      decisionTimeBudget(new std::chrono::milliseconds(*other.decisionTimeBudget)),
+      orderCoalescing(new bool(*other.orderCoalescing)),
+      territoryRenumbering(new bool(*other.territoryRenumbering)),
+      phaseProfiling(new bool(*other.phaseProfiling)),
+      orderBudget(new std::size_t(*other.orderBudget)),
+      progressInterval(new std::chrono::milliseconds(*other.progressInterval)),
+      progressPath(new std::string(*other.progressPath)),
+      progress(other.progress), // shared, not owned
+      batchTournament(new bool(*other.batchTournament)) {
     // Deep copy gameMap if it exists
     if(other.gameMap){
         gameMap = new Map(*other.gameMap);
@@ -152,11 +205,6 @@ GameEngine::GameEngine(const GameEngine& other)
     for (Player* player : *other.players) {
         players->push_back(player);
     }
-
-    // Deep copy deck if it exists
-    if(other.deck) {
-        deck = new Deck(*other.deck);
-    }
 }
 
 /** @brief Destructor cleans up all dynamically allocated resources */
@@ -164,9 +212,21 @@ GameEngine::~GameEngine() {
     delete currentState;
     delete stateTransitions;
     delete players;
+    delete continentGraph; // listens to the map's territories: released first
     delete gameMap;      // GameEngine owns the map
     delete mapLoader;    // GameEngine owns the map loader
-    delete deck;
+    delete context;      // after the map: its Neutral player may own territories
+    delete loadedMapName;
+    delete turnNumber;
+    delete lastTurn;
+    delete decisionTimeBudget;
+    delete orderCoalescing;
+    delete territoryRenumbering;
+    delete phaseProfiling;
+    delete orderBudget;
+    delete progressInterval;
+    delete progressPath;
+    delete batchTournament;
 }
 
 /**
@@ -180,12 +240,39 @@ GameEngine& GameEngine::operator=(const GameEngine& other) {
         delete currentState;
         delete stateTransitions;
         delete players;
+        resetContinentGraph();
         delete gameMap;
         delete mapLoader;
-        delete deck;
+        delete context;
+        delete loadedMapName;
+        delete turnNumber;
+        delete lastTurn;
+        delete decisionTimeBudget;
+        delete orderCoalescing;
+        delete territoryRenumbering;
+        delete phaseProfiling;
+        delete orderBudget;
+        delete progressInterval;
+        delete progressPath;
+        delete batchTournament;
         
         // Deep copy from other
         currentState = new GameState(*other.currentState);
+        loadedMapName = new std::string(*other.loadedMapName);
+        stateFile = nullptr; // a state file records the game of one engine
+        turnNumber = new int(*other.turnNumber);
+        lastTurn = new int(*other.lastTurn);
+        decisionTimeBudget = new std::chrono::milliseconds(*other.decisionTimeBudget);
+        orderCoalescing = new bool(*other.orderCoalescing);
+        territoryRenumbering = new bool(*other.territoryRenumbering);
+        phaseProfiling = new bool(*other.phaseProfiling);
+        orderBudget = new std::size_t(*other.orderBudget);
+        progressInterval = new std::chrono::milliseconds(*other.progressInterval);
+        progressPath = new std::string(*other.progressPath);
+        progress = other.progress; // shared, not owned
+        batchTournament = new bool(*other.batchTournament);
+        openingBook = other.openingBook; // shared, not owned
+        strategyPool = other.strategyPool; // shared, not owned
         stateTransitions = new TransitionMap(*other.stateTransitions);
         players = new vector<Player*>();
         
@@ -208,12 +295,7 @@ GameEngine& GameEngine::operator=(const GameEngine& other) {
             mapLoader = nullptr;
         }
 
-        // Deep copy deck if it exists
-        if(other.deck) {
-            deck = new Deck(*other.deck);
-        } else {
-            deck = nullptr;
-        }
+        context = new GameContext(*other.context);
     }
     return *this;
 }
@@ -377,9 +459,25 @@ string GameEngine::getStateName(GameState state) const {
     }
 }
 
-// Getter for the deck variable.
+// Getter for the deck of the game.
 Deck* GameEngine::getDeck() {
-    return deck;
+    return &context->getDeck();
+}
+
+/** @brief Neutral player, randomness, deck, log and metrics of the engine's game */
+GameContext& GameEngine::getGameContext() {
+    return *context;
+}
+
+/**
+ * @brief Make a player part of the engine's game
+ * @details Its orders reach the game's Neutral player and randomness through the context, and
+ *          are logged by the context's log observer when one is set.
+ */
+void GameEngine::attachToGame(Player* player) {
+    if (!player) return;
+    player->setGameContext(context);
+    if (context->getLog()) player->getOrdersList()->attach(context->getLog());
 }
 
 /**
@@ -575,6 +673,22 @@ void GameEngine::startupPhase(GameEngine& engine, CommandProcessor& commandPro)
 }
 
 
+/**
+ * @brief Continent graph of the current map, built on first use and then kept up to date by the territories
+ */
+ContinentGraph& GameEngine::getContinentGraph() {
+    if (!continentGraph) {
+        continentGraph = new ContinentGraph(*gameMap);
+    }
+    return *continentGraph;
+}
+
+/** @brief Drop the continent graph; required before the map's territories are deleted or replaced */
+void GameEngine::resetContinentGraph() {
+    delete continentGraph;
+    continentGraph = nullptr;
+}
+
 /**
  * @brief Transition to a new state
  * @param newState The new state to transition to
@@ -669,7 +783,10 @@ bool GameEngine::extractMapFilename(const std::string& command, std::string& map
         std::cerr << "    ERROR: No map filename provided." << std::endl;
         std::cerr << "    Usage: loadmap <filename>" << std::endl;
         std::cerr << "    Example: loadmap World.map" << std::endl;
-        std::cerr << "    Available maps are in assets/maps/ directory" << std::endl;
+        std::cerr << "    Available maps are in assets/maps/ directory:" << std::endl;
+        for (const MapIndexEntry& entry : MapIndex::forDefaultDirectory().getEntries()) {
+            if (entry.valid) std::cerr << "      " << entry.fileName << std::endl;
+        }
         return false;
     }
     
@@ -696,9 +813,16 @@ bool GameEngine::extractMapFilename(const std::string& command, std::string& map
  * @return true if the file exists and is accessible, false otherwise
  */
 bool GameEngine::validateMapFileExists(const std::string& mapPath) const {
-    std::ifstream fileCheck(mapPath);
-    bool exists = fileCheck.good();
-    fileCheck.close();
+    // Maps of the indexed directory are answered by the map index; other paths are opened directly
+    const std::filesystem::path path(mapPath);
+    MapIndex& index = MapIndex::forDefaultDirectory();
+    bool exists = false;
+    if (path.parent_path() == std::filesystem::path(index.getDirectory())) {
+        exists = index.find(path.filename().string()) != nullptr;
+    } else {
+        std::ifstream fileCheck(mapPath);
+        exists = fileCheck.good();
+    }
     
     if (!exists) {
         std::cerr << "    ERROR: Map file not found: " << mapPath << std::endl;
@@ -737,8 +861,16 @@ bool GameEngine::handleLoadMap(const string& command, std::string& effectMsg) {
     
     // Load map using the full path
     try {
-        mapLoader->loadMap(mapPath, *gameMap);
+        resetContinentGraph(); // the old territories are about to be deleted
+        {
+            PerfScope scope(profiling(), PerfPhase::LoadMap);
+            mapLoader->loadMap(mapPath, *gameMap);
+        }
+        *loadedMapName = mapName;
         std::cout << "    SUCCESS: Map '" << mapName << "' loaded from " << mapPath << "." << std::endl;
+        if (*territoryRenumbering) {
+            std::cout << "    Renumbered territories: " << gameMap->renumberForLocality() << std::endl;
+        }
         effectMsg = "Map '" + mapName + "' successfully loaded from " + mapPath + ".";
         return true;
     } catch (const std::exception& e) {
@@ -759,7 +891,11 @@ bool GameEngine::handleValidateMap(std::string& effectMsg) {
     cout << "  -> Validating map..." << endl;
     
     // validate the map.
-    bool validMap = gameMap->validate();
+    bool validMap;
+    {
+        PerfScope scope(profiling(), PerfPhase::ValidateMap);
+        validMap = gameMap->validate();
+    }
 
     if(validMap) {
         std::cout << "    The map is valid." << std::endl;
@@ -772,6 +908,38 @@ bool GameEngine::handleValidateMap(std::string& effectMsg) {
     }
 }
 
+/**
+ * @brief Install a map loaded and validated by a MapPrefetcher (tournament games)
+ * @param prepared Map of the game; the engine takes its map over
+ * @param effectMsg Output parameter for effect message (success or error)
+ * @return true if the map was loaded, false otherwise
+ *
+ * @details Prints what handleLoadMap() and handleValidateMap() print, without loading anything.
+ */
+bool GameEngine::handlePreparedMap(PreparedMap& prepared, std::string& effectMsg) {
+    cout << "  -> Loading map..." << endl;
+    if (!prepared.map) {
+        effectMsg = "ERROR: Failed to load map '" + prepared.mapName + "': " + prepared.error;
+        std::cerr << "    ERROR: Failed to load map '" << prepared.mapName << "': " << prepared.error << std::endl;
+        return false;
+    }
+
+    resetContinentGraph(); // the old territories are about to be deleted
+    delete gameMap;
+    gameMap = prepared.map;
+    prepared.map = nullptr;
+    *loadedMapName = prepared.mapName;
+    std::cout << "    SUCCESS: Map '" << prepared.mapName << "' prepared in the background." << std::endl;
+    if (prepared.renumbered) {
+        std::cout << "    Renumbered territories: " << prepared.report << std::endl;
+    }
+
+    cout << "  -> Validating map..." << endl;
+    std::cout << (prepared.valid ? "    The map is valid." : "    The map is NOT valid.") << std::endl;
+    effectMsg = "Map '" + prepared.mapName + "' prepared in the background.";
+    return true;
+}
+
 /**
  * @brief Handle add player command
  * @param command The command that triggered this action
@@ -806,10 +974,20 @@ bool GameEngine::handleAddPlayer(const string& command, std::string& effectMsg)
     }
     playerName = playerName.substr(start, end - start + 1);
 
-    // Add player into GameEngine's vectors of players.
-    players->push_back(new Player(playerName));
+    // Add player into GameEngine's vectors of players. A player named after a registered
+    // strategy (e.g. "addplayer Aggressive" in a tournament) is controlled by that strategy.
+    Player* player = new Player(playerName);
+    attachToGame(player);
+    PlayerStrategy* strategy = strategyPool ? strategyPool->acquire(playerName)
+                                            : StrategyRegistry::instance().create(playerName);
+    if (strategy) {
+        player->setPlayerStrategy(strategy);
+    }
+    players->push_back(player);
 
-    std::cout << "    Player '" << playerName << "' successfully added." << std::endl;
+    std::cout << "    Player '" << playerName << "' successfully added"
+              << (strategy ? std::string(" (") + strategy->getStrategyName() + " strategy)." : std::string("."))
+              << std::endl;
     effectMsg = "Player '" + playerName + "' successfully added to the game.";
     return true;
 }
@@ -858,6 +1036,7 @@ void GameEngine::handleEndGame(const string& command) {
  * @brief Main game loop managing the phases of the game
  */
 void GameEngine::reinforcementPhase() {
+    PerfScope scope(profiling(), PerfPhase::Reinforcement);
     if(!gameMap || !players || players->empty()) {
         cout << "Reinforcement phase skipped (no map or players).\n";
         return;
@@ -865,7 +1044,7 @@ void GameEngine::reinforcementPhase() {
 
     std::cout << "\n--- Reinforcement Phase ---\n";
 
-    const auto& continents = gameMap->getContinents();
+    const ContinentGraph& graph = getContinentGraph();
 
     for(Player* p : *players) {
         if (!p) continue;
@@ -878,25 +1057,11 @@ void GameEngine::reinforcementPhase() {
             continue;
         }
 
-        //Base: floor(#territories / 3), minimum 3
-          int base = territoryCount / 3;
-        if (base < 3) base = 3;
-
-        // Continent bonuses
-        int bonus = 0;
-        for (Continent* c : continents) {
-            if (!c) continue;
-            bool ownsAll = true;
-            for (Territory* t : c->getTerritories()) {
-                if (!t || t->getOwner() != p) {
-                    ownsAll = false;
-                    break;
-                }
-            }
-            if (ownsAll) {
-                bonus += c->getBonus();
-            }
-        }
+        //Base: floor(#territories / 3), minimum 3 (standard rules)
+        int base = GameRules::baseReinforcement<ActiveRules>(territoryCount);
+
+        // Continent bonuses, from the incrementally maintained continent summaries
+        int bonus = graph.continentBonus(p);
 
         int total = base + bonus;
         p->addReinforcements(total);
@@ -916,6 +1081,7 @@ void GameEngine::reinforcementPhase() {
  * @brief Issue orders phase where players issue their orders in round-robin fashion
  */
 void GameEngine::issueOrdersPhase() {
+    PerfScope scope(profiling(), PerfPhase::IssueOrders);
     std::cout << "\n--- Issue Orders Phase ---\n";
     if (!players || players->empty()) return;
 
@@ -930,6 +1096,57 @@ void GameEngine::issueOrdersPhase() {
     // Track whether each player already issued a non-deploy in THIS phase
     std::vector<bool> nonDeployIssued(n, false);
 
+    // Order budget: every list accepts up to the budget again; a player whose list is full is not
+    // asked for more orders this phase (its strategy also sees add() refuse them)
+    std::vector<bool> budgetReached(n, false);
+    std::vector<std::size_t> droppedBefore(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        OrdersList* ol = (*players)[i] ? (*players)[i]->getOrdersList() : nullptr;
+        if (!ol) continue;
+        ol->setBudget(*orderBudget);
+        ol->beginTurn();
+        droppedBefore[i] = ol->getDropped();
+    }
+
+    // Opening book: during the first turns, opted-in strategies replay recorded orders (hit)
+    // or have the orders they issue this phase recorded for later games (miss).
+    const int turn = turnNumber ? *turnNumber : 0;
+    const bool useBook = openingBook && gameMap && turn >= 1 && turn <= openingBook->getDepth();
+    std::vector<bool> replayedFromBook(n, false);
+    std::vector<bool> recordToBook(n, false);
+    std::vector<OpeningBookKey> bookKeys(n);
+    std::vector<std::size_t> ordersBeforePhase(n, 0);
+
+    if (useBook) {
+        const std::uint64_t mapHash = OpeningBook::hashMap(*gameMap);
+        for (std::size_t i = 0; i < n; ++i) {
+            Player* p = (*players)[i];
+            PlayerStrategy* strat = p ? p->getPlayerStrategy() : nullptr;
+            const char* bookId = strat ? strat->openingBookId() : nullptr;
+            if (!bookId || !p->getOrdersList()) continue;
+
+            OpeningBookKey& key = bookKeys[i];
+            key.mapHash = mapHash;
+            key.playerCount = static_cast<int>(n);
+            key.turn = turn;
+            key.positionHash = OpeningBook::hashPosition(*gameMap, *players, p, bookId);
+
+            const std::vector<OpeningBookMove>* moves = openingBook->lookup(key);
+            if (moves && replayOpeningMoves(p, *moves)) {
+                replayedFromBook[i] = true;
+            } else {
+                recordToBook[i] = true;
+                ordersBeforePhase[i] = p->getOrdersList()->size();
+            }
+        }
+    }
+
+    // Per-player decision time left in this phase; interactive (human) players are not timed
+    using DecisionClock = DecisionBudget::Clock;
+    const bool timed = decisionTimeBudget->count() > 0;
+    std::vector<DecisionClock::duration> timeLeft(n, DecisionClock::duration(*decisionTimeBudget));
+    std::vector<bool> outOfTime(n, false);
+
     bool issuedInPass = false;
     std::size_t safetyCounter = 0;
     const std::size_t safetyLimit = 1000; // hard cap to avoid livelock from bad logic
@@ -939,7 +1156,7 @@ void GameEngine::issueOrdersPhase() {
 
         for (std::size_t i = 0; i < n; ++i) {
             Player* p = (*players)[i];
-            if (!p) continue;
+            if (!p || replayedFromBook[i] || outOfTime[i] || budgetReached[i]) continue;
 
             // If no reinforcements left and this player already issued one non-deploy this phase,
             // skip further non-deploys until next phase (after execution changes state).
@@ -950,7 +1167,26 @@ void GameEngine::issueOrdersPhase() {
             OrdersList* ol = p->getOrdersList();
             const std::size_t before = (ol ? ol->size() : 0);
 
-            const bool created = p->issueOrder();
+            PlayerStrategy* strat = p->getPlayerStrategy();
+            const bool timedPlayer = timed && !(strat && strat->isInteractive());
+            DecisionBudget budget = timedPlayer ? DecisionBudget(timeLeft[i]) : DecisionBudget();
+            const DecisionClock::time_point started = DecisionClock::now();
+
+            const bool created = p->issueOrder(budget);
+
+            if (timedPlayer) {
+                timeLeft[i] -= DecisionClock::now() - started;
+                if (timeLeft[i] <= DecisionClock::duration::zero()) {
+                    outOfTime[i] = true;
+                    std::cout << "[Budget] " << p->getPlayerName()
+                              << " used its decision time for this turn.\n";
+                }
+            }
+            if (ol && ol->isFull()) {
+                budgetReached[i] = true;
+                std::cout << "[Backpressure] " << p->getPlayerName() << " reached its budget of "
+                          << ol->getBudget() << " orders for this turn.\n";
+            }
             if (!created) continue;
 
             issuedInPass = true;
@@ -976,6 +1212,211 @@ void GameEngine::issueOrdersPhase() {
 
         // Repeat another pass only if at least one player created an order this pass.
     } while (issuedInPass);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        OrdersList* ol = (*players)[i] ? (*players)[i]->getOrdersList() : nullptr;
+        if (!ol) continue;
+        if (budgetReached[i]) ++context->getOrderBudgetStats().limitedTurns;
+        context->getOrderBudgetStats().droppedOrders += ol->getDropped() - droppedBefore[i];
+    }
+
+    // Record the openings of players that missed the book. Only Deploy/Advance orders can be
+    // stored; a phase containing anything else (e.g. card orders) is not recorded.
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!recordToBook[i]) continue;
+
+        const std::vector<Order*>& issued = (*players)[i]->getOrdersList()->getOrders();
+        std::vector<OpeningBookMove> moves;
+        bool recordable = true;
+        for (std::size_t k = ordersBeforePhase[i]; k < issued.size() && recordable; ++k) {
+            OpeningBookMove move;
+            if (DeployOrder* deploy = dynamic_cast<DeployOrder*>(issued[k])) {
+                move.type = OpeningBookMove::Type::Deploy;
+                move.targetId = deploy->getTarget() ? deploy->getTarget()->getId() : -1;
+                move.amount = deploy->getAmount();
+            } else if (AdvanceOrder* advance = dynamic_cast<AdvanceOrder*>(issued[k])) {
+                move.type = OpeningBookMove::Type::Advance;
+                move.sourceId = advance->getSource() ? advance->getSource()->getId() : -1;
+                move.targetId = advance->getTarget() ? advance->getTarget()->getId() : -1;
+                move.amount = Armies::toInt(advance->getAmount());
+                recordable = move.amount == advance->getAmount(); // the book stores int amounts
+            } else {
+                recordable = false;
+            }
+            moves.push_back(move);
+        }
+        if (recordable) openingBook->record(bookKeys[i], moves);
+    }
+}
+
+/**
+ * @brief Set the time each bot may spend deciding its orders in one issue phase
+ * @param budget Per-player per-turn budget; zero or negative disables the limit
+ */
+void GameEngine::setDecisionTimeBudget(std::chrono::milliseconds budget) {
+    *decisionTimeBudget = budget.count() > 0 ? budget : std::chrono::milliseconds(0);
+}
+
+/** @brief Get the per-player per-turn decision time budget (0 = unlimited) */
+std::chrono::milliseconds GameEngine::getDecisionTimeBudget() const {
+    return *decisionTimeBudget;
+}
+
+/**
+ * @brief Enable or disable order coalescing in the execute phase (see OrderCoalescing.h)
+ * @param enabled True to merge same-target Deploys and same-pair Advances before executing them
+ */
+void GameEngine::setOrderCoalescing(bool enabled) {
+    *orderCoalescing = enabled;
+}
+
+/** @brief Whether the execute phase coalesces orders */
+bool GameEngine::isOrderCoalescing() const {
+    return *orderCoalescing;
+}
+
+/**
+ * @brief Enable or disable locality renumbering of the maps loaded by loadmap
+ * @param enabled True to run Map::renumberForLocality() after every successful load
+ */
+void GameEngine::setTerritoryRenumbering(bool enabled) {
+    *territoryRenumbering = enabled;
+}
+
+/** @brief Whether loaded maps are renumbered for locality */
+bool GameEngine::isTerritoryRenumbering() const {
+    return *territoryRenumbering;
+}
+
+/**
+ * @brief Enable or disable performance counters around the phases, map loading and validation
+ * @param enabled True to add every measured call to getPhaseProfile() (see PerfCounters.h)
+ */
+void GameEngine::setPhaseProfiling(bool enabled) {
+    *phaseProfiling = enabled;
+}
+
+/** @brief Whether the phases are measured */
+bool GameEngine::isPhaseProfiling() const {
+    return *phaseProfiling;
+}
+
+/** @brief Counters of the measured phases (of the game, or of every game of a tournament) */
+const PhaseProfile& GameEngine::getPhaseProfile() const {
+    return context->getPhaseProfile();
+}
+
+/**
+ * @brief Limit the orders each player may issue per turn
+ * @param maxOrdersPerTurn Budget applied to every player's OrdersList, or OrdersList::UNLIMITED_BUDGET
+ */
+void GameEngine::setOrderBudget(std::size_t maxOrdersPerTurn) {
+    *orderBudget = maxOrdersPerTurn;
+}
+
+/** @brief Orders each player may issue per turn (0 = unlimited) */
+std::size_t GameEngine::getOrderBudget() const {
+    return *orderBudget;
+}
+
+/** @brief Turns limited and orders dropped by the order budget (of the game, or of a tournament) */
+const OrderBudgetStats& GameEngine::getOrderBudgetStats() const {
+    return context->getOrderBudgetStats();
+}
+
+/**
+ * @brief Report the progress of the next tournaments while they run
+ * @param interval Time between two reports, or 0 to turn reporting off
+ * @param statusPath File whose contents each report replaces; empty to print them to stderr
+ */
+void GameEngine::setProgressReporting(std::chrono::milliseconds interval, const std::string& statusPath) {
+    *progressInterval = interval < std::chrono::milliseconds(0) ? std::chrono::milliseconds(0) : interval;
+    *progressPath = statusPath;
+}
+
+/** @brief Time between two tournament progress reports (0 = off) */
+std::chrono::milliseconds GameEngine::getProgressInterval() const {
+    return *progressInterval;
+}
+
+/** @brief Status file of the tournament progress reports (empty = stderr) */
+const std::string& GameEngine::getProgressPath() const {
+    return *progressPath;
+}
+
+/** @brief Counters of the running tournament, e.g. for a dashboard thread (nullptr outside of one) */
+const TournamentProgress* GameEngine::getTournamentProgress() const {
+    return progress;
+}
+
+/**
+ * @brief Enable or disable lockstep batch tournaments
+ * @param enabled True to play the games of each map of a bot-only tournament in one BatchSimulation
+ *        (simplified rules, see BatchSimulation.h) instead of one engine game at a time
+ */
+void GameEngine::setBatchTournament(bool enabled) {
+    *batchTournament = enabled;
+}
+
+/** @brief Whether tournaments are played in a BatchSimulation */
+bool GameEngine::isBatchTournament() const {
+    return *batchTournament;
+}
+
+/** @brief Profile the measured calls go to, or nullptr when profiling is off */
+PhaseProfile* GameEngine::profiling() {
+    return *phaseProfiling ? &context->getPhaseProfile() : nullptr;
+}
+
+/**
+ * @brief Materialize the orders an opening book entry recorded for a player
+ * @param player Player whose orders are replayed
+ * @param moves Recorded moves (territory ids refer to the current map)
+ * @return true if every move was applicable and the orders were issued, false otherwise
+ *         (nothing is issued in that case and the strategy decides as usual)
+ */
+bool GameEngine::replayOpeningMoves(Player* player, const std::vector<OpeningBookMove>& moves) {
+    if (!player || !gameMap || !player->getOrdersList()) return false;
+
+    std::unordered_map<int, Territory*> byId;
+    for (Territory* t : gameMap->getTerritories()) {
+        if (t) byId[t->getId()] = t;
+    }
+    auto find = [&byId](int id) -> Territory* {
+        auto it = byId.find(id);
+        return it == byId.end() ? nullptr : it->second;
+    };
+
+    // Check everything first so a stale entry never leaves a half-issued opening behind
+    int deployTotal = 0;
+    for (const OpeningBookMove& move : moves) {
+        Territory* target = find(move.targetId);
+        if (!target || move.amount <= 0) return false;
+        if (move.type == OpeningBookMove::Type::Deploy) {
+            if (target->getOwner() != player) return false;
+            deployTotal += move.amount;
+        } else {
+            Territory* source = find(move.sourceId);
+            if (!source || source->getOwner() != player || !source->isAdjacentTo(target)) return false;
+        }
+    }
+    if (deployTotal > player->getReinforcementPool()) return false;
+    if (moves.size() > player->getOrdersList()->remaining()) return false; // over the order budget
+
+    // Same bookkeeping the strategies do when issuing: deploys are taken out of the pool right away
+    for (const OpeningBookMove& move : moves) {
+        Territory* target = find(move.targetId);
+        if (move.type == OpeningBookMove::Type::Deploy) {
+            player->getOrdersList()->add(new DeployOrder(player, target, move.amount));
+            player->subtractFromReinforcementPool(move.amount);
+        } else {
+            player->getOrdersList()->add(new AdvanceOrder(player, find(move.sourceId), target, move.amount));
+        }
+    }
+
+    std::cout << "[OpeningBook] " << player->getPlayerName() << " replays "
+              << moves.size() << " recorded order(s).\n";
+    return true;
 }
 
 
@@ -983,6 +1424,7 @@ void GameEngine::issueOrdersPhase() {
  * @brief Execute orders phase where players' orders are executed in round-robin fashion
  */
 void GameEngine::executeOrdersPhase() {
+    PerfScope scope(profiling(), PerfPhase::ExecuteOrders);
     if (!players || players->empty()) {
         std::cout << "\n--- Execute Orders Phase skipped (no players) ---\n";
         return;
@@ -990,6 +1432,9 @@ void GameEngine::executeOrdersPhase() {
 
     std::cout << "\n--- Execute Orders Phase ---\n";
 
+    // Optional: fold same-target Deploys together before the deploy part runs
+    const int coalescedDeploys = *orderCoalescing ? OrderCoalescing::coalesceDeploys(*players) : 0;
+
     // ========= 1) Execute all DEPLOY orders first =========
     while (true) {
         bool executedAnyDeploy = false;
@@ -1016,6 +1461,13 @@ void GameEngine::executeOrdersPhase() {
         }
     }
 
+    // Optional: fold same-pair Advances together now that the deploys are on the board
+    if (*orderCoalescing) {
+        const int coalescedAdvances = OrderCoalescing::coalesceAdvances(*players);
+        std::cout << "Coalesced " << (coalescedDeploys + coalescedAdvances) << " orders ("
+                  << coalescedDeploys << " deploy, " << coalescedAdvances << " advance)\n";
+    }
+
     // ========= 2) Execute all remaining (non-deploy) orders round-robin =========
     bool executedAny = true;
     while (executedAny) {
@@ -1030,6 +1482,13 @@ void GameEngine::executeOrdersPhase() {
             Order* o = ol->popfront();
             if (!o) continue;
 
+            // A coalesced order keeps its pass but its armies moved with an earlier order
+            if (o->isCoalesced()) {
+                delete o;
+                executedAny = true;
+                continue;
+            }
+
             std::cout << "[Order] " << *o << "\n";
             o->execute();
             delete o;
@@ -1054,11 +1513,12 @@ void GameEngine::removeDefeatedPlayers() {
     auto& vec = *players;
     vec.erase(
         std::remove_if(vec.begin(), vec.end(),
-            [](Player* p) {
+            [this](Player* p) {
                 if (!p) return true; // remove nulls
                 if (p->getOwnedTerritories().empty()) {
                     std::cout << "Player " << p->getPlayerName()
                               << " has been eliminated (no territories).\n";
+                    if (strategyPool) strategyPool->release(p->releasePlayerStrategy());
                     delete p;
                     return true;
                 }
@@ -1119,13 +1579,14 @@ void GameEngine::mainGameLoop() {
 
     while (!gameOver) {
     std::cout << "\n===== TURN " << turn << " =====\n";
+    *turnNumber = turn;
 
     reinforcementPhase();
     issueOrdersPhase();
     executeOrdersPhase();
     
     // Award cards to players who conquered at least one territory this turn
-    std::size_t cardsRemaining = deck->getCardsOnDeck().size();
+    std::size_t cardsRemaining = context->getDeck().getCardsOnDeck().size();
     bool deckBecameEmptyThisTurn = false;
 
     for (Player* player : *players) {
@@ -1139,7 +1600,7 @@ void GameEngine::mainGameLoop() {
       }
 
         // Draw 1 card and award it
-        deck->draw(*player->getPlayerHand());
+        context->getDeck().draw(*player->getPlayerHand(), context->getRandom());
         std::cout << "  -> " << player->getPlayerName() << " conquered a territory and draws a card!\n";
         player->setCardAwardedThisTurn(false);
         --cardsRemaining;
@@ -1166,6 +1627,7 @@ void GameEngine::mainGameLoop() {
 }
 
 
+    *turnNumber = 0;
     std::cout << "===== MAIN GAME LOOP END =====\n";
 }
 
@@ -1175,8 +1637,12 @@ void GameEngine::mainGameLoop() {
  * @param demoPlayers Pointer to the vector of players to use
  */
 void GameEngine::setMapAndPlayersForDemo(Map* map, std::vector<Player*>* ps) {
+    resetContinentGraph();
     gameMap = map;
     players = ps;
+    if (players) {
+        for (Player* p : *players) attachToGame(p);
+    }
 }
 
 // Helper: give ownership + armies and sync with player's territory list
@@ -1338,43 +1804,38 @@ void GameEngine::handleGamestart() {
 
     // (b) Determine randomly the order of play of players (Shuffling the actual vector).
 
-        // Generate random number.
-        std::random_device random;
-        std::mt19937 g(random());
-
-        // Shuffle
-        std::shuffle(players->begin(), players->end(), g);
+        // Shuffle with the random engine of the game.
+        std::shuffle(players->begin(), players->end(), context->getRandom());
 
         std::cout << "  ...Order of players are shuffled.\n\n";
 
 
-    // (c) Give 50 army units to each player.
+    // (c) Give 50 army units to each player (standard rules).
         for(Player* p : *players) {
-            p->setReinforcementPool(50);
+            p->setReinforcementPool(ActiveRules::startingArmies());
         }
     
-        std::cout << "  ...50 army units are assigned to each player.\n\n";
+        std::cout << "  ..." << ActiveRules::startingArmies() << " army units are assigned to each player.\n\n";
 
 
     // (d) Let each player draw 2 initial cards from Deck.
 
-        // LOAD DECK WITH 50 CARDS, 10 of each of the five variations.
-        for(std::size_t i = 0; i < 10; i++) {
-            deck->addCard(new Card(Card::Reinforcement));
-            deck->addCard(new Card(Card::Bomb));
-            deck->addCard(new Card(Card::Blockade));
-            deck->addCard(new Card(Card::Diplomacy));
-            deck->addCard(new Card(Card::Airlift));
+        // LOAD DECK WITH 50 CARDS, 10 of each of the five variations (standard rules).
+        for(int i = 0; i < ActiveRules::cardsPerType(); i++) {
+            context->getDeck().addCard(new Card(Card::Reinforcement));
+            context->getDeck().addCard(new Card(Card::Bomb));
+            context->getDeck().addCard(new Card(Card::Blockade));
+            context->getDeck().addCard(new Card(Card::Diplomacy));
+            context->getDeck().addCard(new Card(Card::Airlift));
         }
 
-        std::cout << "  ...Each player draws 2 cards from Deck.\n\n";
+        std::cout << "  ...Each player draws " << ActiveRules::initialCards() << " cards from Deck.\n\n";
 
         for(Player* p : *players) {
             Hand* playerHand = p->getPlayerHand();
-            // std::cout << "  ------Player " << p->getPlayerName() << ":\n    ";
-            deck->draw(*playerHand);
-            // std::cout << "    ";
-            deck->draw(*playerHand);
+            for(int c = 0; c < ActiveRules::initialCards(); c++) {
+                context->getDeck().draw(*playerHand, context->getRandom());
+            }
         }
 
 
@@ -1413,7 +1874,7 @@ void GameEngine::printGamestartLog() const {
     
 
     // (c) Give 50 army units to each player.
-        std::cout << "=== (c) Give 50 army units to each player: ===" << std::endl;
+        std::cout << "=== (c) Give " << ActiveRules::startingArmies() << " army units to each player: ===" << std::endl;
         for(Player* p : *players) {
             std::cout << "Player " << p->getPlayerName() << " - Reinforcement Pool: " << p->getReinforcementPool() << std::endl;
         }
@@ -1421,7 +1882,7 @@ void GameEngine::printGamestartLog() const {
 
 
     // (d) Let each player draw 2 initial cards from Deck.
-        std::cout << "=== (d) Let each player draw 2 cards from the Deck: ===" << std::endl;
+        std::cout << "=== (d) Let each player draw " << ActiveRules::initialCards() << " cards from the Deck: ===" << std::endl;
         for(Player* p : *players) {
             std::cout << "  Player " << p->getPlayerName() << " - ";
             p->getPlayerHand()->showHand();
@@ -1438,6 +1899,25 @@ void GameEngine::printGamestartLog() const {
 
 // === A3, PART 2: TOURNAMENT MODE ===
 
+/** @brief Print the winner of every game, one row per map */
+static void printTournamentResults(const std::vector<std::vector<std::string>>& results) {
+    std::cout << "\nResults:\n\t";
+    for (std::size_t g = 0; g < (results.empty() ? 0 : results[0].size()); ++g) {
+        std::cout << "Game " << (g + 1) << "\t";
+    }
+    std::cout << "\n";
+
+    for (std::size_t m = 0; m < results.size(); ++m) {
+        std::cout << "Map " << (m + 1) << "\t";
+        for (const std::string& result : results[m]) {
+            std::cout << result << "\t";
+        }
+        std::cout << "\n";
+    }
+
+    std::cout << std::endl;
+}
+
 /**
  * @brief Execuion the tournament command after being validated and processed in the CommandProcessor.
  * @param command, a string that should contain the values of -M (listOfMaps), -P (listOfPlayerStrats), -G (numOfGames), and -D (maxNumOfTurns).
@@ -1478,35 +1958,66 @@ bool GameEngine::handleTournament(const std::string& command) {
         if (i + 1 < playerStrats.size()) std::cout << ", ";
     }
     std::cout << "\nG: " << numGames << "\n";
-    std::cout << "D: " << maxNumTurns << "\n\n";
+    std::cout << "D: " << maxNumTurns << "\n";
+    std::cout << "Rules: " << activeRuleSet() << "\n\n";
 
     std::vector<std::vector<std::string>> results(
         mapNames.size(),
         std::vector<std::string>(numGames, "Draw")
     );
 
-    for (std::size_t m = 0; m < mapNames.size(); ++m) {
-        for (int g = 0; g < numGames; ++g) {
-            std::cout << "  -> Running game " << (g + 1) << " on map " << mapNames[m] << "...\n";
-            results[m][g] = runSingleTournamentGame(mapNames[m], playerStrats, maxNumTurns);
-        }
+    if (*batchTournament) {
+        return playBatchTournament(mapNames, playerStrats, numGames, maxNumTurns, results);
     }
 
-    std::cout << "\nResults:\n\t";
-    for (int g = 0; g < numGames; ++g) {
-        std::cout << "Game " << (g + 1) << "\t";
+    // Opening book shared by every game of the tournament (and by later runs through the file)
+    OpeningBook book(OPENING_BOOK_PATH);
+    openingBook = &book;
+
+    // Strategy objects are reused from game to game instead of being reallocated
+    StrategyPool pool;
+    strategyPool = &pool;
+
+    // Maps of the next games are loaded and validated in the background while a game simulates
+    MapPrefetcher prefetcher(mapNames, numGames, *territoryRenumbering, *phaseProfiling);
+    context->getPhaseProfile().clear();
+    context->getOrderBudgetStats() = OrderBudgetStats();
+
+    // Counters fed by the games; a reporter thread prints them if progress reporting is on
+    TournamentProgress tracker(mapNames, numGames);
+    progress = &tracker;
+    if (progressInterval->count() > 0) {
+        tracker.startReporting(*progressInterval, *progressPath);
     }
-    std::cout << "\n";
 
     for (std::size_t m = 0; m < mapNames.size(); ++m) {
-        std::cout << "Map " << (m + 1) << "\t";
         for (int g = 0; g < numGames; ++g) {
-            std::cout << results[m][g] << "\t";
+            std::cout << "  -> Running game " << (g + 1) << " on map " << mapNames[m] << "...\n";
+            PreparedMap prepared = prefetcher.next();
+            tracker.gameStarted(m);
+            results[m][g] = runSingleTournamentGame(prepared, playerStrats, maxNumTurns);
+            tracker.gameFinished(m);
         }
-        std::cout << "\n";
     }
+    tracker.stopReporting();
+
+    printTournamentResults(results);
+
+    book.save();
+    std::cout << book << "\n" << pool << "\n" << prefetcher << "\n" << std::endl;
+    if (*phaseProfiling) {
+        context->getPhaseProfile() += prefetcher.getProfile(); // map loading and validation ran on the stage thread
+        std::cout << "Phase profile of the tournament:\n" << context->getPhaseProfile() << std::endl;
+    }
+    if (*orderBudget != OrdersList::UNLIMITED_BUDGET) {
+        std::cout << "Order budget of the tournament (" << *orderBudget << " per player per turn): "
+                  << context->getOrderBudgetStats() << "\n" << std::endl;
+    }
+    std::cout << "Tournament " << tracker << "\n" << std::endl;
+    openingBook = nullptr;
+    strategyPool = nullptr;
+    progress = nullptr;
 
-    std::cout << std::endl;
     // ** TODO: THE REST IS ROMAN'S IMPLEMENTATION! **
     // Note: To get the values of the tournament command, see the printTournamentCommandLog() function in CommandProcessor.
     // use extractMapOrPlayerOfTournament() to return a vector of int values of the tournament (numOfMaps, numOfPlayerStratsIndex, numOfGames, maxNumOfTurns).
@@ -1524,6 +2035,7 @@ bool GameEngine::handleTournament(const std::string& command) {
  */
 std::string GameEngine::runSingleTournamentGame(const std::string& mapName, const std::vector<std::string>& playerStrats, int maxNumTurns) {
     GameEngine game;
+    copyTournamentSettings(game);
 
     std::string effect;
     std::string loadCmd = "loadmap " + mapName;
@@ -1537,6 +2049,53 @@ std::string GameEngine::runSingleTournamentGame(const std::string& mapName, cons
         return "Draw";
     }
 
+    return playTournamentGame(game, playerStrats, maxNumTurns);
+}
+
+/**
+ * @brief Run a single game in tournament mode on a map prepared by a MapPrefetcher
+ * @param prepared Map of the game (its map is taken over, even on failure)
+ * @param playerStrats Vector of player strategy names
+ * @param maxNumTurns Maximum number of turns before declaring a draw
+ * @return The name of the winning player, or "Draw" if no winner
+ */
+std::string GameEngine::runSingleTournamentGame(PreparedMap& prepared, const std::vector<std::string>& playerStrats, int maxNumTurns) {
+    GameEngine game;
+    copyTournamentSettings(game);
+
+    std::string effect;
+    if (!game.handlePreparedMap(prepared, effect)) {
+        std::cout << "    ERROR loading map " << prepared.mapName << ": " << effect << "\n";
+        return "Draw";
+    }
+
+    if (!prepared.valid) {
+        std::cout << "    ERROR validating map " << prepared.mapName
+                  << ": ERROR: Map validation failed. The map does not meet the required criteria.\n";
+        return "Draw";
+    }
+
+    return playTournamentGame(game, playerStrats, maxNumTurns);
+}
+
+/** @brief Give the engine of a tournament game the shared book, pool and options of this engine */
+void GameEngine::copyTournamentSettings(GameEngine& game) const {
+    game.openingBook = openingBook;
+    game.strategyPool = strategyPool;
+    *game.decisionTimeBudget = *decisionTimeBudget;
+    *game.orderCoalescing = *orderCoalescing;
+    *game.territoryRenumbering = *territoryRenumbering;
+    *game.phaseProfiling = *phaseProfiling;
+    *game.orderBudget = *orderBudget;
+    game.progress = progress;
+}
+
+/**
+ * @brief Add the players to a tournament game whose map is loaded, start it and play it
+ * @return The name of the winning player, or "Draw" if no winner
+ */
+std::string GameEngine::playTournamentGame(GameEngine& game, const std::vector<std::string>& playerStrats, int maxNumTurns) {
+    std::string effect;
     for (const std::string& strat : playerStrats) {
         std::string addCmd = "addplayer " + strat;    
         if (!game.handleAddPlayer(addCmd, effect)) {
@@ -1548,9 +2107,76 @@ std::string GameEngine::runSingleTournamentGame(const std::string& mapName, cons
     game.handleGamestart();
 
     std::string winner = game.runGameWithTurnLimit(maxNumTurns);
+
+    // Hand the strategies back to the pool before the players are deleted
+    if (strategyPool) {
+        for (Player* player : *game.players) {
+            strategyPool->release(player->releasePlayerStrategy());
+        }
+    }
+    context->getPhaseProfile() += game.context->getPhaseProfile();
+    context->getOrderBudgetStats() += game.context->getOrderBudgetStats();
     return winner;
 }
 
+/**
+ * @brief Play the games of a bot-only tournament map by map, each map in one lockstep BatchSimulation
+ * @param mapNames Maps of the tournament, loaded and validated like engine games
+ * @param playerStrats Strategies of the players (2 to 4 of those BatchSimulation::supports())
+ * @param numGames Games per map (lanes of each simulation)
+ * @param maxTurns Turn limit after which undecided games are draws
+ * @param results Winner strategy of every game, or "Draw" (filled per map, then printed)
+ * @return false if the line-up is not supported; maps that fail to load or validate count as draws
+ */
+bool GameEngine::playBatchTournament(const std::vector<std::string>& mapNames, const std::vector<std::string>& playerStrats,
+                                     int numGames, int maxTurns, std::vector<std::vector<std::string>>& results) {
+    const int playerCount = static_cast<int>(playerStrats.size());
+    bool supported = playerCount >= BatchSimulation::MIN_PLAYERS && playerCount <= BatchSimulation::MAX_PLAYERS;
+    for (const std::string& strat : playerStrats) supported = supported && BatchSimulation::supports(strat);
+    if (!supported) {
+        std::cout << "  -> ERROR: batch tournaments need 2 to 4 players among Aggressive, Benevolent, Neutral and Cheater.\n" << std::endl;
+        return false;
+    }
+    std::cout << "Batch: " << numGames << " games per map in lockstep; no cards, orders resolved as issued,"
+              << " attacks in territory order (see BatchSimulation.h)\n\n";
+
+    context->getPhaseProfile().clear();
+    TournamentProgress tracker(mapNames, numGames);
+    progress = &tracker;
+    if (progressInterval->count() > 0) {
+        tracker.startReporting(*progressInterval, *progressPath);
+    }
+
+    for (std::size_t m = 0; m < mapNames.size(); ++m) {
+        std::cout << "  -> Running " << numGames << " games on map " << mapNames[m] << "...\n";
+        for (int g = 0; g < numGames; ++g) tracker.gameStarted(m);
+
+        GameEngine game;
+        copyTournamentSettings(game);
+        std::string effect;
+        if (!game.handleLoadMap("loadmap " + mapNames[m], effect)) {
+            std::cout << "    ERROR loading map " << mapNames[m] << ": " << effect << "\n";
+        } else if (!game.handleValidateMap(effect)) {
+            std::cout << "    ERROR validating map " << mapNames[m] << ": " << effect << "\n";
+        } else {
+            BatchSimulation batch(*game.gameMap, playerStrats, numGames, context->getRandom()());
+            results[m] = batch.run(maxTurns);
+            std::cout << "    " << batch << "\n";
+        }
+        context->getPhaseProfile() += game.context->getPhaseProfile();
+        for (int g = 0; g < numGames; ++g) tracker.gameFinished(m);
+    }
+    tracker.stopReporting();
+
+    printTournamentResults(results);
+    if (*phaseProfiling) {
+        std::cout << "Phase profile of the tournament:\n" << context->getPhaseProfile() << std::endl;
+    }
+    std::cout << "Tournament " << tracker << "\n" << std::endl;
+    progress = nullptr;
+    return true;
+}
+
 /**
  * @brief Run the game with a turn limit for tournament mode
  * @param maxTurns Maximum number of turns before declaring a draw
@@ -1562,18 +2188,42 @@ std::string GameEngine::runGameWithTurnLimit(int maxTurns) {
         return "Draw";
     }
 
+    if (stateFile && !stateFile->isOpen()) {
+        if (stateFile->create(*loadedMapName, *gameMap, *players, *context)) {
+            commitState(0, CommittedPhase::TurnEnded); // state right after gamestart
+        } else {
+            std::cerr << "    WARNING: cannot create game state file " << stateFile->getPath()
+                      << "; the game is not recorded." << std::endl;
+            stateFile = nullptr;
+        }
+    }
+    return playTurns(1, false, maxTurns);
+}
+
+/**
+ * @brief Play turns until a player wins or the turn limit is reached
+ * @param firstTurn Number of the first turn to play
+ * @param firstTurnReinforced true if the reinforcement of the first turn already happened (resume)
+ * @param maxTurns Last turn to play
+ * @return The name of the winning player, or "Draw" if no winner
+ */
+std::string GameEngine::playTurns(int firstTurn, bool firstTurnReinforced, int maxTurns) {
     bool gameOver = false;
-    int turn = 1;
+    int turn = firstTurn;
     Player* winner = nullptr;
 
     while (!gameOver && turn <= maxTurns) {
         std::cout << "\n===== TOURNAMENT TURN " << turn << " =====\n";
+        *turnNumber = turn;
 
-        reinforcementPhase();
+        if (!(turn == firstTurn && firstTurnReinforced)) {
+            reinforcementPhase();
+            commitState(turn, CommittedPhase::Reinforced);
+        }
         issueOrdersPhase();
         executeOrdersPhase();
 
-    std::size_t cardsRemaining = deck->getCardsOnDeck().size();
+    std::size_t cardsRemaining = context->getDeck().getCardsOnDeck().size();
 
     for (Player* player : *players) {
     if (!player) continue;
@@ -1585,7 +2235,7 @@ std::string GameEngine::runGameWithTurnLimit(int maxTurns) {
         continue;
     }
 
-    deck->draw(*player->getPlayerHand());
+    context->getDeck().draw(*player->getPlayerHand(), context->getRandom());
     std::cout << "  -> " << player->getPlayerName()
               << " conquered a territory and draws a card!\n";
 
@@ -1594,6 +2244,9 @@ std::string GameEngine::runGameWithTurnLimit(int maxTurns) {
  }
 
         removeDefeatedPlayers();
+        commitState(turn, CommittedPhase::TurnEnded);
+        *lastTurn = turn;
+        if (progress) progress->turnCompleted();
 
         if (checkWinCondition(winner)) {
             gameOver = true;
@@ -1602,9 +2255,96 @@ std::string GameEngine::runGameWithTurnLimit(int maxTurns) {
         ++turn;
     }
 
+    *turnNumber = 0;
+    transition(gameOver && winner ? GameState::Win : GameState::End); // End: turn limit reached
+
+    if (*phaseProfiling) {
+        std::cout << "\nPhase profile of the game:\n" << context->getPhaseProfile();
+    }
+    if (*orderBudget != OrdersList::UNLIMITED_BUDGET) {
+        std::cout << "\nOrder budget (" << *orderBudget << " per player per turn): " << context->getOrderBudgetStats() << "\n";
+    }
+
     if (gameOver && winner) {
         return winner->getPlayerName();   
     }
 
     return "Draw";
 }
+
+/** @brief Record the state at a phase boundary when a state file is attached */
+void GameEngine::commitState(int turn, CommittedPhase phase) {
+    if (stateFile) stateFile->commit(turn, phase, *gameMap, *players, *context);
+}
+
+/**
+ * @brief Write the current game as JSON: state, turn, board (owners and armies) and players
+ * @details Outside of the game loop the turn is the last one played, e.g. the final turn of a
+ *          finished game, whose state is Win or End (turn limit).
+ * @param out Destination stream
+ * @return false, writing nothing, if no map is loaded
+ */
+bool GameEngine::writeStateJson(std::ostream& out) const {
+    if (!gameMap) return false;
+    MapWriter::writeGameStateJson(*gameMap, *players, getStateName(), *turnNumber != 0 ? *turnNumber : *lastTurn, out);
+    return true;
+}
+
+/**
+ * @brief Record the next game played with runGameWithTurnLimit() in a state file
+ * @param file State file, created when the game starts (not owned; nullptr stops recording)
+ */
+void GameEngine::setStateFile(GameStateFile* file) {
+    stateFile = file;
+}
+
+/**
+ * @brief Continue a game recorded in a state file after its process died
+ * @param file State file of the game (attached here, then kept up to date)
+ * @param maxTurns Last turn to play
+ * @return The name of the winning player, or "Draw" if no winner
+ * @throws std::runtime_error if the file holds no committed game or its map cannot be loaded
+ *
+ * @details Loads the recorded map, recreates the surviving players with their current strategies,
+ * puts the committed board, pools and cards back, then resumes after the last committed phase.
+ */
+std::string GameEngine::resumeGame(GameStateFile& file, int maxTurns) {
+    if (!players->empty()) throw std::logic_error("resumeGame requires an engine without players");
+    if (!file.attach()) throw std::runtime_error("No committed game state in " + file.getPath());
+
+    std::string effect;
+    if (!handleLoadMap("loadmap " + file.getMapName(), effect) || !handleValidateMap(effect)) {
+        throw std::runtime_error("Cannot resume " + file.getPath() + ": " + effect);
+    }
+
+    std::vector<Player*> slotPlayers;
+    for (std::size_t slot = 0; slot < file.getSlotCount(); ++slot) {
+        if (!file.isAlive(slot)) {
+            slotPlayers.push_back(nullptr);
+            continue;
+        }
+        Player* player = new Player(file.getPlayerName(slot));
+        attachToGame(player);
+        const std::string strategyName = file.getStrategyName(slot);
+        if (!strategyName.empty()) {
+            player->setPlayerStrategy(strategyPool ? strategyPool->acquire(strategyName)
+                                                   : StrategyRegistry::instance().create(strategyName));
+        }
+        players->push_back(player);
+        slotPlayers.push_back(player);
+    }
+    file.restore(*gameMap, slotPlayers, *context);
+    transition(GameState::AssignReinforcement);
+    stateFile = &file;
+
+    std::cout << "  -> Resuming " << file << std::endl;
+    *lastTurn = file.getPhase() == CommittedPhase::TurnEnded ? file.getTurn() : file.getTurn() - 1;
+    Player* winner = nullptr;
+    if (checkWinCondition(winner)) {
+        transition(GameState::Win);
+        return winner->getPlayerName();
+    }
+
+    const bool reinforced = file.getPhase() == CommittedPhase::Reinforced;
+    return playTurns(reinforced ? file.getTurn() : file.getTurn() + 1, reinforced, maxTurns);
+}
@@ -0,0 +1,161 @@
+/**
+ * @file GameRules.cpp
+ * @brief Runtime-configurable rule set (the standard rules are entirely in GameRules.h).
+ */
+
+#include "../include/GameRules.h"
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace {
+    /** @brief Text without its leading and trailing whitespace */
+    std::string trim(const std::string& text) {
+        const std::size_t first = text.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return "";
+        return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+    }
+
+    /** @brief Value of a rule; throws std::invalid_argument unless the whole text is a number */
+    double numberValue(const std::string& key, const std::string& text) {
+        std::size_t used = 0;
+        double value = 0.0;
+        try {
+            value = std::stod(text, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == 0 || used != text.size()) throw std::invalid_argument("Invalid value for rule " + key + ": " + text);
+        return value;
+    }
+
+    /** @brief Integer value of a rule; throws std::invalid_argument unless the text is an int */
+    int integerValue(const std::string& key, const std::string& text) {
+        const double value = numberValue(key, text);
+        if (value != std::floor(value) || value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max()) {
+            throw std::invalid_argument("Rule " + key + " must be an integer: " + text);
+        }
+        return static_cast<int>(value);
+    }
+}
+
+/**
+ * @brief Read a rule set from a file of key=value lines
+ * @details Keys are the member names of RuleSet; rules that are not listed keep their standard
+ *          value. Blank lines and lines starting with '#' or ';' are ignored.
+ * @param path Rules file
+ * @return The validated rule set
+ * @throws std::runtime_error if the file cannot be read
+ * @throws std::invalid_argument on a malformed line, an unknown key or an invalid rule set
+ */
+RuleSet RuleSet::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Cannot open rules file " + path);
+
+    RuleSet rules;
+    std::string line;
+    for (int number = 1; std::getline(in, line); ++number) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#' || line[0] == ';') continue;
+        const std::size_t equals = line.find('=');
+        if (equals == std::string::npos) {
+            throw std::invalid_argument(path + ":" + std::to_string(number) + ": expected key=value");
+        }
+        try {
+            rules.set(trim(line.substr(0, equals)), trim(line.substr(equals + 1)));
+        } catch (const std::invalid_argument& e) {
+            throw std::invalid_argument(path + ":" + std::to_string(number) + ": " + e.what());
+        }
+    }
+    rules.validate();
+    return rules;
+}
+
+/**
+ * @brief Change one rule
+ * @param key Member name (e.g. "startingArmies")
+ * @param value Number as text
+ * @throws std::invalid_argument for an unknown key or a value that is not a number of the rule's type
+ */
+void RuleSet::set(const std::string& key, const std::string& value) {
+    if (key == "attackerKillProbability") attackerKillProbability = numberValue(key, value);
+    else if (key == "defenderKillProbability") defenderKillProbability = numberValue(key, value);
+    else if (key == "reinforcementDivisor") reinforcementDivisor = integerValue(key, value);
+    else if (key == "minimumReinforcement") minimumReinforcement = integerValue(key, value);
+    else if (key == "startingArmies") startingArmies = integerValue(key, value);
+    else if (key == "cardsPerType") cardsPerType = integerValue(key, value);
+    else if (key == "initialCards") initialCards = integerValue(key, value);
+    else if (key == "bombDivisor") bombDivisor = integerValue(key, value);
+    else throw std::invalid_argument("Unknown rule: " + key);
+}
+
+/**
+ * @brief Check that every rule value is usable by the kernels
+ * @throws std::invalid_argument if a probability is outside [0, 1] or a count/divisor is invalid
+ */
+void RuleSet::validate() const {
+    if (attackerKillProbability < 0.0 || attackerKillProbability > 1.0 ||
+        defenderKillProbability < 0.0 || defenderKillProbability > 1.0) {
+        throw std::invalid_argument("Kill probabilities must be between 0 and 1.");
+    }
+    if (attackerKillProbability == 0.0 && defenderKillProbability == 0.0) {
+        throw std::invalid_argument("At least one kill probability must be positive, or battles never end.");
+    }
+    if (reinforcementDivisor < 1 || bombDivisor < 1) {
+        throw std::invalid_argument("Reinforcement and bomb divisors must be at least 1.");
+    }
+    if (minimumReinforcement < 0 || startingArmies < 0 || cardsPerType < 0 || initialCards < 0) {
+        throw std::invalid_argument("Reinforcements, armies and card counts cannot be negative.");
+    }
+}
+
+bool RuleSet::operator==(const RuleSet& other) const {
+    return attackerKillProbability == other.attackerKillProbability
+        && defenderKillProbability == other.defenderKillProbability
+        && reinforcementDivisor == other.reinforcementDivisor
+        && minimumReinforcement == other.minimumReinforcement
+        && startingArmies == other.startingArmies
+        && cardsPerType == other.cardsPerType
+        && initialCards == other.initialCards
+        && bombDivisor == other.bombDivisor;
+}
+
+bool RuleSet::operator!=(const RuleSet& other) const {
+    return !(*this == other);
+}
+
+/** @brief Stream insertion operator prints every rule value */
+std::ostream& operator<<(std::ostream& os, const RuleSet& rules) {
+    os << "RuleSet [attacker kill: " << rules.attackerKillProbability
+       << ", defender kill: " << rules.defenderKillProbability
+       << ", reinforcement: territories/" << rules.reinforcementDivisor
+       << " (min " << rules.minimumReinforcement << ")"
+       << ", starting armies: " << rules.startingArmies
+       << ", cards per type: " << rules.cardsPerType
+       << ", initial cards: " << rules.initialCards
+       << ", bomb: armies/" << rules.bombDivisor << "]";
+    return os;
+}
+
+/** @brief Process-wide rule values used by RuntimeRules (standard rules until configured) */
+RuleSet& RuntimeRules::settings() {
+    static RuleSet rules;
+    return rules;
+}
+
+/**
+ * @brief Install a new rule set
+ * @param rules Rule values to use from now on
+ * @throws std::invalid_argument if the rule set is invalid (the current rules are kept)
+ */
+void RuntimeRules::configure(const RuleSet& rules) {
+    rules.validate();
+    settings() = rules;
+}
+
+/** @brief Rules the game is played with: the configured set in a runtime-rules build, the standard rules otherwise */
+RuleSet activeRuleSet() {
+    return RULES_CONFIGURABLE ? RuntimeRules::settings() : RuleSet();
+}
@@ -0,0 +1,499 @@
+/**
+ * @file GameStateFile.cpp
+ * @brief Memory-mapped game state: layout, double-slot commits and recovery.
+ *
+ * File layout (native byte order):
+ *   header : magic[8] "WZSTATE\1", u32 version, u32 territories, u32 player slots, u32 cards,
+ *            u32 byte-order mark, u32 random engine bytes, map name[NAME_SIZE],
+ *            player names[slots][NAME_SIZE]
+ *   live board (64-byte aligned): i64 armies[territories], i32 owner[territories], written on
+ *            every change
+ *   slot 0, slot 1 (64-byte aligned), each:
+ *            u64 sequence (commit marker, 0 = invalid), u64 checksum of the rest of the used bytes,
+ *            i32 turn, i32 phase,
+ *            i64 armies[territories], i32 owner[territories] (copy of the live board),
+ *            i32 pool[slots], i32 holder[cards], u8 alive[slots], u8 cardType[cards],
+ *            strategy names[slots][NAME_SIZE], random engine (raw std::mt19937_64, 8-byte aligned)
+ *   Territory arrays are in map file order (original ids), so a renumbered map resumes as well.
+ */
+
+#include "../include/GameStateFile.h"
+#include "../include/Map.h"
+#include "../include/Player.h"
+#include "../include/PlayerStrategies.h"
+#include "../include/Cards.h"
+#include "../include/GameContext.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+using std::vector;
+
+/** @brief Anonymous namespace containing the fixed parts of the layout */
+namespace {
+    const char MAGIC[8] = {'W', 'Z', 'S', 'T', 'A', 'T', 'E', '\1'};
+    const std::uint32_t VERSION = 4; // 2: 64-bit army counts, 3: Neutral owner and random engine, 4: live board
+    const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+    const std::size_t RANDOM_STATE_BYTES = sizeof(std::mt19937_64);
+    static_assert(std::is_trivially_copyable<std::mt19937_64>::value, "the random engine is stored as raw bytes");
+    const std::size_t FIXED_HEADER_SIZE = 32;
+    const std::size_t SLOT_HEADER_SIZE = 24; // sequence, checksum, turn, phase
+    const std::size_t ALIGNMENT = 64;
+
+    std::size_t alignUp(std::size_t value) { return (value + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+    /** @brief Copy a name into a fixed, zero-padded field (truncated if too long) */
+    void writeName(unsigned char* field, const string& name) {
+        std::memset(field, 0, GameStateFile::NAME_SIZE);
+        std::memcpy(field, name.data(), std::min(name.size(), GameStateFile::NAME_SIZE - 1));
+    }
+
+    string readName(const unsigned char* field) {
+        const char* text = reinterpret_cast<const char*>(field);
+        return string(text, std::find(text, text + GameStateFile::NAME_SIZE, '\0'));
+    }
+}
+
+/**
+ * @brief Offsets of every array, derived from the territory, player and card counts.
+ */
+struct GameStateFile::Layout {
+    std::size_t territories, players, cards;
+    std::size_t liveOffset, boardBytes, slotOffset[2], usedBytes, slotBytes, fileBytes;
+    std::size_t owner, armies, pool, holder, alive, cardType, strategy, random; // offsets within a slot
+
+    Layout(std::size_t t, std::size_t p, std::size_t c) : territories(t), players(p), cards(c) {
+        boardBytes = 12 * t; // armies then owner, in the live board and in each slot
+        armies = SLOT_HEADER_SIZE; // 8-byte aligned
+        owner = armies + 8 * t;
+        pool = owner + 4 * t;
+        holder = pool + 4 * p;
+        alive = holder + 4 * c;
+        cardType = alive + p;
+        strategy = cardType + c;
+        random = (strategy + NAME_SIZE * p + 7) / 8 * 8;
+        usedBytes = random + RANDOM_STATE_BYTES;
+        slotBytes = alignUp(usedBytes);
+        liveOffset = alignUp(FIXED_HEADER_SIZE + NAME_SIZE * (1 + p));
+        slotOffset[0] = alignUp(liveOffset + boardBytes);
+        slotOffset[1] = slotOffset[0] + slotBytes;
+        fileBytes = slotOffset[1] + slotBytes;
+    }
+};
+
+// ======================= GameStateFile =======================
+
+GameStateFile::GameStateFile(const string& path)
+    : path(path), data(nullptr), size(0), layout(nullptr), current(-1), slotPlayers(), board(), boardIndex(),
+      boardContext(nullptr) {}
+
+GameStateFile::~GameStateFile() {
+    unmap();
+}
+
+bool GameStateFile::mapFile(int fd, std::size_t bytes) {
+#if !defined(_WIN32)
+    void* mapped = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) return false;
+    data = static_cast<unsigned char*>(mapped);
+    size = bytes;
+    return true;
+#else
+    (void)fd;
+    (void)bytes;
+    return false;
+#endif
+}
+
+void GameStateFile::unmap() {
+    unbindBoard();
+#if !defined(_WIN32)
+    if (data) ::munmap(data, size);
+#endif
+    data = nullptr;
+    size = 0;
+    delete layout;
+    layout = nullptr;
+    current = -1;
+}
+
+/**
+ * @brief Create (or truncate) the file for a game that just started and map it
+ * @param mapName Map file name as given to `loadmap` (e.g. "World.map")
+ * @param map Loaded map (fixes the territory count and order)
+ * @param players Players in turn order (fixes the player slots)
+ * @param context Context of the game; its deck after the initial draws (with the hands) fixes the card count
+ * @return true if the file is mapped and listens to the map's territories; nothing is committed yet
+ */
+bool GameStateFile::create(const string& mapName, const Map& map, const vector<Player*>& players,
+                           const GameContext& context) {
+    unmap();
+    std::size_t cards = context.getDeck().getCardsOnDeck().size();
+    for (const Player* p : players) cards += p->getPlayerHand()->getCardsOnHand().size();
+    Layout* fresh = new Layout(map.getTerritories().size(), players.size(), cards);
+
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    const bool mapped = fd >= 0 && ::ftruncate(fd, static_cast<off_t>(fresh->fileBytes)) == 0 &&
+                        mapFile(fd, fresh->fileBytes);
+    if (fd >= 0) ::close(fd); // the mapping stays valid without the descriptor
+#else
+    const bool mapped = false;
+#endif
+    if (!mapped) {
+        delete fresh;
+        return false;
+    }
+    layout = fresh;
+
+    std::memcpy(data, MAGIC, sizeof(MAGIC));
+    const std::uint32_t header[6] = {VERSION, static_cast<std::uint32_t>(layout->territories),
+                                     static_cast<std::uint32_t>(layout->players),
+                                     static_cast<std::uint32_t>(layout->cards), BYTE_ORDER_MARK,
+                                     static_cast<std::uint32_t>(RANDOM_STATE_BYTES)};
+    std::memcpy(data + sizeof(MAGIC), header, sizeof(header));
+    writeName(data + FIXED_HEADER_SIZE, mapName);
+    for (std::size_t s = 0; s < players.size(); ++s) {
+        writeName(data + FIXED_HEADER_SIZE + NAME_SIZE * (1 + s), players[s]->getPlayerName());
+    }
+    bindPlayers(players);
+    bindBoard(map, context);
+    return true;
+}
+
+/**
+ * @brief Map an existing file and select its newest valid commit
+ * @return true if a committed phase was found (false for a missing, foreign or uncommitted file)
+ */
+bool GameStateFile::attach() {
+    unmap();
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) return false;
+    struct stat info;
+    const bool mapped = ::fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(FIXED_HEADER_SIZE) &&
+                        mapFile(fd, static_cast<std::size_t>(info.st_size));
+    ::close(fd);
+    if (!mapped) return false;
+#else
+    return false;
+#endif
+
+    std::uint32_t header[6];
+    std::memcpy(header, data + sizeof(MAGIC), sizeof(header));
+    if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0 || header[0] != VERSION || header[4] != BYTE_ORDER_MARK ||
+        header[5] != RANDOM_STATE_BYTES) {
+        unmap();
+        return false;
+    }
+    layout = new Layout(header[1], header[2], header[3]);
+    if (layout->fileBytes != size) {
+        unmap();
+        return false;
+    }
+
+    const bool valid0 = slotIsValid(0);
+    const bool valid1 = slotIsValid(1);
+    if (valid0 && valid1) {
+        std::uint64_t seq0, seq1;
+        std::memcpy(&seq0, slot(0), 8);
+        std::memcpy(&seq1, slot(1), 8);
+        current = seq1 > seq0 ? 1 : 0;
+    } else {
+        current = valid0 ? 0 : (valid1 ? 1 : -1);
+    }
+    return current >= 0;
+}
+
+unsigned char* GameStateFile::slot(int index) const {
+    return data + layout->slotOffset[index];
+}
+
+/** @brief Word-wise multiply-xorshift hash of the used bytes of a slot, marker and checksum excluded */
+std::uint64_t GameStateFile::checksumOf(const unsigned char* slotData) const {
+    std::uint64_t h = 0x9e3779b97f4a7c15ULL ^ layout->usedBytes;
+    std::size_t i = 16;
+    for (; i + 8 <= layout->usedBytes; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, slotData + i, 8);
+        h = (h ^ word) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+    }
+    std::uint64_t tail = 0; // the used bytes end on the 8-byte aligned engine; kept for safety
+    std::memcpy(&tail, slotData + i, layout->usedBytes - i);
+    h = (h ^ tail) * 0xff51afd7ed558ccdULL;
+    return h ^ (h >> 32);
+}
+
+bool GameStateFile::slotIsValid(int index) const {
+    std::uint64_t sequence, checksum;
+    std::memcpy(&sequence, slot(index), 8);
+    std::memcpy(&checksum, slot(index) + 8, 8);
+    return sequence != 0 && checksum == checksumOf(slot(index));
+}
+
+void GameStateFile::bindPlayers(const vector<Player*>& players) {
+    slotPlayers.assign(players.begin(), players.end());
+}
+
+/**
+ * @brief Listen to the territories of the recorded map and write all of them into the live board
+ * @param map Map of the game; territories are recorded in file order
+ * @param context Context of the game (its Neutral player, once created, owns territories as NEUTRAL_OWNER)
+ */
+void GameStateFile::bindBoard(const Map& map, const GameContext& context) {
+    unbindBoard();
+    board = map.getTerritoriesInFileOrder();
+    board.resize(std::min(board.size(), layout->territories));
+    boardContext = &context;
+    for (std::size_t t = 0; t < board.size(); ++t) {
+        const int id = board[t]->getId();
+        if (id < 0) continue;
+        if (static_cast<std::size_t>(id) >= boardIndex.size()) boardIndex.resize(id + 1, -1);
+        boardIndex[id] = static_cast<std::int32_t>(t);
+        board[t]->addListener(this);
+        writeLive(*board[t], t);
+    }
+}
+
+/** @brief Stop listening to the recorded territories */
+void GameStateFile::unbindBoard() {
+    for (Territory* t : board) {
+        if (t) t->removeListener(this);
+    }
+    board.clear();
+    boardIndex.clear();
+    boardContext = nullptr;
+}
+
+void GameStateFile::writeLive(const Territory& territory, std::size_t index) {
+    unsigned char* live = data + layout->liveOffset;
+    const std::int64_t armies = territory.getArmies();
+    const std::int32_t owner = slotOf(territory.getOwner(), boardContext->getNeutralPlayerIfCreated());
+    std::memcpy(live + 8 * index, &armies, 8);
+    std::memcpy(live + 8 * layout->territories + 4 * index, &owner, 4);
+}
+
+/** @brief A recorded territory changed: store its owner and armies in the live board */
+void GameStateFile::territoryChanged(const Territory& territory, Player* previousOwner, ArmyCount previousArmies) {
+    (void)previousOwner;
+    (void)previousArmies;
+    const int id = territory.getId();
+    if (id >= 0 && static_cast<std::size_t>(id) < boardIndex.size() && boardIndex[id] >= 0) {
+        writeLive(territory, static_cast<std::size_t>(boardIndex[id]));
+    }
+}
+
+/** @brief A recorded territory is going away: its last state stays in the live board */
+void GameStateFile::territoryDestroyed(const Territory& territory) {
+    const int id = territory.getId();
+    if (id >= 0 && static_cast<std::size_t>(id) < boardIndex.size() && boardIndex[id] >= 0) {
+        board[boardIndex[id]] = nullptr;
+        boardIndex[id] = -1;
+    }
+}
+
+/** @brief Slot of a player of this game, NEUTRAL_OWNER for the Neutral player, NO_OWNER otherwise */
+int GameStateFile::slotOf(const Player* player, const Player* neutral) const {
+    if (!player) return NO_OWNER;
+    if (player == neutral) return NEUTRAL_OWNER;
+    for (std::size_t s = 0; s < slotPlayers.size(); ++s) {
+        if (slotPlayers[s] == player) return static_cast<int>(s);
+    }
+    return NO_OWNER;
+}
+
+/**
+ * @brief Record the state at the end of a phase
+ * @param turn Turn the phase belongs to (0 for the state right after `gamestart`)
+ * @param phase Phase that just completed
+ * @param map Map of the game (same territories as at create(); its board is already in the live region)
+ * @param players Players still in the game; the others are recorded as eliminated
+ * @param context Context of the game: deck, Neutral player and random engine
+ * @throws std::logic_error if the file is not open, or the territory or card count changed
+ *
+ * @details The inactive slot is invalidated, written, checksummed, and only then given the next
+ * sequence number, so a crash at any point leaves the previous commit selectable.
+ * @complexity One block copy of the live board plus O(players + cards); no system call
+ */
+void GameStateFile::commit(int turn, CommittedPhase phase, const Map& map, const vector<Player*>& players,
+                           const GameContext& context) {
+    if (!data) throw std::logic_error("Game state file is not open: " + path);
+    if (map.getTerritories().size() != layout->territories) {
+        throw std::logic_error("Territory count changed since the game started");
+    }
+
+    std::uint64_t previous = 0;
+    if (current >= 0) std::memcpy(&previous, slot(current), 8);
+    const int target = current == 0 ? 1 : 0;
+    unsigned char* s = slot(target);
+    std::memset(s, 0, 8); // invalidate the slot before overwriting it
+
+    const std::int32_t header[2] = {turn, static_cast<std::int32_t>(phase)};
+    std::memcpy(s + 16, header, sizeof(header));
+
+    std::memcpy(s + layout->armies, data + layout->liveOffset, layout->boardBytes); // armies, then owners
+    const Player* neutral = context.getNeutralPlayerIfCreated();
+
+    std::int32_t* pool = reinterpret_cast<std::int32_t*>(s + layout->pool);
+    std::int32_t* holder = reinterpret_cast<std::int32_t*>(s + layout->holder);
+    unsigned char* alive = s + layout->alive;
+    unsigned char* cardType = s + layout->cardType;
+    std::memset(alive, 0, layout->players);
+    std::memset(s + layout->strategy, 0, NAME_SIZE * layout->players);
+
+    std::size_t card = 0;
+    auto recordCards = [&](const vector<Card*>& cards, std::int32_t cardHolder) {
+        if (card + cards.size() > layout->cards) throw std::logic_error("Card count changed since the game started");
+        for (const Card* c : cards) {
+            holder[card] = cardHolder;
+            cardType[card] = static_cast<unsigned char>(c->getCard());
+            ++card;
+        }
+    };
+    recordCards(context.getDeck().getCardsOnDeck(), -1);
+    for (const Player* p : players) {
+        const int index = slotOf(p, neutral);
+        if (index < 0) continue;
+        alive[index] = 1;
+        pool[index] = p->getReinforcementPool();
+        const PlayerStrategy* strategy = p->getPlayerStrategy();
+        writeName(s + layout->strategy + NAME_SIZE * index, strategy ? strategy->getStrategyName() : "");
+        recordCards(p->getPlayerHand()->getCardsOnHand(), index);
+    }
+    for (; card < layout->cards; ++card) holder[card] = -2; // card left the game with its player
+
+    std::memcpy(s + layout->random, &context.getRandom(), RANDOM_STATE_BYTES);
+
+    const std::uint64_t checksum = checksumOf(s);
+    std::memcpy(s + 8, &checksum, 8);
+    std::atomic_thread_fence(std::memory_order_release); // payload before the commit marker
+    const std::uint64_t sequence = previous + 1;
+    std::memcpy(s, &sequence, 8);
+    current = target;
+}
+
+/** @brief Flush the mapping to disk and wait for it (not needed to survive a crash of the process) */
+void GameStateFile::sync() const {
+#if !defined(_WIN32)
+    if (data) ::msync(data, size, MS_SYNC);
+#endif
+}
+
+/**
+ * @brief Put the committed board, pools, cards and random engine back into a freshly loaded game
+ * @param map Map loaded from getMapName() (no owners yet)
+ * @param players Player of each slot, nullptr for eliminated slots (bound for later commits)
+ * @param context Context of the game with an empty deck; receives the Neutral territories and
+ *        the random engine state
+ * @throws std::runtime_error if the map does not match the recorded game
+ *
+ * @details The file then listens to the restored territories, so later commits see the live board.
+ */
+void GameStateFile::restore(Map& map, const vector<Player*>& players, GameContext& context) {
+    if (!data || current < 0) throw std::runtime_error("No committed game state in " + path);
+    const vector<Territory*> territories = map.getTerritoriesInFileOrder();
+    if (territories.size() != layout->territories || players.size() != layout->players) {
+        throw std::runtime_error("Map or players do not match the game state in " + path);
+    }
+
+    const unsigned char* s = slot(current);
+    const std::int32_t* owner = reinterpret_cast<const std::int32_t*>(s + layout->owner);
+    const std::int64_t* armies = reinterpret_cast<const std::int64_t*>(s + layout->armies);
+    for (std::size_t t = 0; t < territories.size(); ++t) {
+        if (owner[t] >= 0 && static_cast<std::size_t>(owner[t]) < players.size() && players[owner[t]]) {
+            players[owner[t]]->addPlayerTerritory(territories[t]);
+        } else if (owner[t] == NEUTRAL_OWNER) {
+            context.getNeutralPlayer()->addPlayerTerritory(territories[t]);
+        }
+        territories[t]->setArmies(armies[t]);
+    }
+
+    std::memcpy(&context.getRandom(), s + layout->random, RANDOM_STATE_BYTES);
+
+    const std::int32_t* pool = reinterpret_cast<const std::int32_t*>(s + layout->pool);
+    for (std::size_t p = 0; p < players.size(); ++p) {
+        if (players[p]) players[p]->setReinforcementPool(pool[p]);
+    }
+
+    const std::int32_t* holder = reinterpret_cast<const std::int32_t*>(s + layout->holder);
+    const unsigned char* cardType = s + layout->cardType;
+    for (std::size_t c = 0; c < layout->cards; ++c) {
+        Card* card = new Card(static_cast<Card::typeOfCard>(cardType[c]));
+        if (holder[c] == -1) context.getDeck().addCard(card);
+        else if (holder[c] >= 0 && static_cast<std::size_t>(holder[c]) < players.size() && players[holder[c]]) {
+            players[holder[c]]->getPlayerHand()->addCard(card);
+        } else delete card;
+    }
+
+    bindPlayers(players);
+    bindBoard(map, context);
+}
+
+bool GameStateFile::isOpen() const { return data != nullptr; }
+const string& GameStateFile::getPath() const { return path; }
+
+string GameStateFile::getMapName() const {
+    return data ? readName(data + FIXED_HEADER_SIZE) : string();
+}
+
+std::size_t GameStateFile::getSlotCount() const { return layout ? layout->players : 0; }
+
+string GameStateFile::getPlayerName(std::size_t s) const {
+    return s < getSlotCount() ? readName(data + FIXED_HEADER_SIZE + NAME_SIZE * (1 + s)) : string();
+}
+
+string GameStateFile::getStrategyName(std::size_t s) const {
+    if (current < 0 || s >= getSlotCount()) return string();
+    return readName(slot(current) + layout->strategy + NAME_SIZE * s);
+}
+
+bool GameStateFile::isAlive(std::size_t s) const {
+    return current >= 0 && s < getSlotCount() && slot(current)[layout->alive + s] != 0;
+}
+
+int GameStateFile::getTurn() const {
+    if (current < 0) return 0;
+    std::int32_t turn;
+    std::memcpy(&turn, slot(current) + 16, 4);
+    return turn;
+}
+
+CommittedPhase GameStateFile::getPhase() const {
+    if (current < 0) return CommittedPhase::None;
+    std::int32_t phase;
+    std::memcpy(&phase, slot(current) + 20, 4);
+    return static_cast<CommittedPhase>(phase);
+}
+
+std::uint64_t GameStateFile::getSequence() const {
+    std::uint64_t sequence = 0;
+    if (current >= 0) std::memcpy(&sequence, slot(current), 8);
+    return sequence;
+}
+
+std::ostream& operator<<(std::ostream& os, const GameStateFile& file) {
+    os << "GameStateFile [" << file.path;
+    if (file.isOpen()) {
+        os << ", map: " << file.getMapName() << ", players: " << file.getSlotCount() << ", turn: " << file.getTurn()
+           << (file.getPhase() == CommittedPhase::Reinforced ? " (reinforced)"
+               : file.getPhase() == CommittedPhase::TurnEnded ? " (ended)" : " (nothing committed)")
+           << ", commits: " << file.getSequence();
+    } else {
+        os << ", closed";
+    }
+    os << "]";
+    return os;
+}
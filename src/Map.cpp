@@ -14,14 +14,21 @@
 
 #include "../include/Map.h"
 #include "../include/Player.h"
+#include "../include/MapIndex.h"
+#include "../include/MapArchive.h"
 #include <iostream>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
+#include <charconv>
+#include <cstdlib>
 #include <limits>
+#include <stdexcept>
 #include <filesystem>
 #include <utility> 
+#include <memory>
+#include <thread>
 
 // Importing only the neccessary std functions.
 namespace fs = std::filesystem;
@@ -43,9 +50,6 @@ using std::make_unique;
 
 /** @brief Anonymous namespace containing map parsing utilities and constants */
 namespace {
-    /// Directory path containing game map files
-    const string MAP_PATH = "assets/maps";
-
     /**
      * @brief Context structure for map file parsing state
      * 
@@ -70,6 +74,12 @@ namespace {
         int nextTerritoryId = 0;  ///< Auto-incrementing ID for new territories
     };
 
+    /// Territory sections shorter than this are parsed on the calling thread
+    constexpr size_t PARALLEL_PARSE_MIN_LINES = 8192;
+
+    /// Smallest chunk worth handing to a worker thread
+    constexpr size_t MIN_LINES_PER_CHUNK = 2048;
+
     /**
      * @brief Removes leading and trailing whitespace from a string
      * @param rawLine The input string to trim
@@ -117,42 +127,6 @@ namespace {
         return result;
     }
 
-    /**
-     * @brief Lists all .map files in a directory sorted alphabetically by filename
-     * @param dir Path to directory containing map files
-     * @return Vector of file paths sorted by filename
-     * 
-     * @throws std::runtime_error if directory doesn't exist or isn't accessible
-     * 
-     * @details Scans the specified directory for files with .map extension,
-     * sorts them alphabetically by filename for consistent ordering.
-     * Only includes regular files, ignoring subdirectories and special files.
-     * 
-     * @complexity O(n log n) where n is the number of .map files (due to sorting)
-     */
-    static vector<fs::path> listMapFiles(const fs::path& dir) {
-        vector<fs::path> mapFiles;
-
-        // Validate directory existence and accessibility
-        if (!fs::exists(dir) || !fs::is_directory(dir)) {
-            throw runtime_error("Map directory does not exist or is not a directory: " + dir.string());
-        }
-
-        // Scan directory for .map files, filtering out non-regular files
-        for (const fs::directory_entry& fileEntry : fs::directory_iterator(dir)) {
-            if (fileEntry.is_regular_file() && fileEntry.path().extension() == ".map") {
-                mapFiles.push_back(fileEntry.path());
-            }
-        }
-
-        // Sort alphabetically by filename for consistent user experience
-        sort(mapFiles.begin(), mapFiles.end(), [](const fs::path& a, const fs::path& b){
-            return a.filename().string() < b.filename().string();
-        });
-
-        return mapFiles;
-    }
-
     /**
      * @brief Parses a continent definition line from a map file
      * @param line Raw line from map file containing continent definition
@@ -197,60 +171,72 @@ namespace {
         context.continentMap[continentName] = rawPointer; // Index for fast lookup during parsing
     }
 
+    /** @brief Integer value of a coordinate token, 0 if it is not a number */
+    inline int parseCoordinate(string_view token) {
+        int value = 0;
+        std::from_chars(token.data(), token.data() + token.size(), value);
+        return value;
+    }
+
     /**
-     * @brief Parses a territory definition line from a map file
-     * @param line Raw line from map file containing territory definition
+     * @brief Adds one tokenized territory definition to the map
+     * @param tokens Comma-separated tokens of the territory line (see csvParse)
+     * @param line Original line, used for error reporting
      * @param context Parsing context for state management and deferred resolution
      * @param mapOutput Target map to add the parsed territory to
-     * 
+     * @param prebuilt Territory already constructed with id context.nextTerritoryId (nullptr to create it here)
+     *
      * @throws std::runtime_error if line format is invalid (< 4 tokens required)
-     * 
+     *
      * @details Expected format: "TerritoryName, X, Y, Continent, Adjacent1, Adjacent2, ..."
      * - Creates territory with auto-generated ID
      * - Handles forward references for adjacencies via waiting list
-     * - Coordinates (X, Y) are parsed but currently unused
+     * - Coordinates (X, Y) are kept on the territory (Territory::getX(), getY())
      * - Uses RAII for exception safety during construction
-     * 
-     * @pre line must contain at least territory name, coordinates, and continent
+     *
+     * @pre tokens must contain at least territory name, coordinates, and continent
      * @post New territory added to map with continent membership and adjacencies
      */
-    static void parseTerritories(const string& line, ParseContext& context, Map& mapOutput){
-        // Parse comma-separated tokens from territory definition line
-        vector<string> tokens = csvParse(line);
-        
+    static void addTerritoryTokens(const vector<string>& tokens, const string& line, ParseContext& context,
+                                   Map& mapOutput, std::unique_ptr<Territory> prebuilt = nullptr){
         if (tokens.size() < 4) throw runtime_error("Invalid territory line: " + line);
 
-        string territoryName = tokens[0];
+        const string& territoryName = tokens[0];
     
         // Create territory using RAII for exception safety during construction
-        auto newTerritory = std::make_unique<Territory>(context.nextTerritoryId++, territoryName);
+        std::unique_ptr<Territory> newTerritory = prebuilt ? std::move(prebuilt)
+            : std::make_unique<Territory>(context.nextTerritoryId, territoryName);
+        ++context.nextTerritoryId;
         Territory* rawPointer = newTerritory.get(); // Keep raw pointer for map ownership transfer
 
         mapOutput.addTerritory(rawPointer); // Transfer ownership to map
         newTerritory.release(); // Release unique_ptr ownership
         context.territoryMap[territoryName] = rawPointer; // Index for fast lookup during parsing
         // Check if any territories were waiting to connect to this one
-        if(context.waitingTerritories.find(territoryName) != context.waitingTerritories.end()) {
-            for(Territory* waitingTerritory : context.waitingTerritories[territoryName]) {
+        auto waiting = context.waitingTerritories.find(territoryName);
+        if(waiting != context.waitingTerritories.end()) {
+            for(Territory* waitingTerritory : waiting->second) {
                 waitingTerritory->addAdjacent(rawPointer);
             }
-            context.waitingTerritories.erase(territoryName); // Clear the waiting list for this territory
+            context.waitingTerritories.erase(waiting); // Clear the waiting list for this territory
         }
     
-        // ignore X, Y for now
+        // Coordinates only matter when the map is drawn or written back; non-numbers are read as 0
+        rawPointer->setCoordinates(parseCoordinate(tokens[1]), parseCoordinate(tokens[2]));
     
         // Get the continent name
-        string continentName = tokens[3];
-        if (context.continentMap.find(continentName) != context.continentMap.end()) {
-            rawPointer->addContinent(context.continentMap[continentName]);
-            context.continentMap[continentName]->addTerritory(rawPointer);
+        auto continent = context.continentMap.find(tokens[3]);
+        if (continent != context.continentMap.end()) {
+            rawPointer->addContinent(continent->second);
+            continent->second->addTerritory(rawPointer);
         }
     
         // Add connections to adjacent territories
         for (size_t i = 4; i < tokens.size(); ++i) {
-            string adjacentName = tokens[i];
-            if (context.territoryMap.find(adjacentName) != context.territoryMap.end()) {
-                rawPointer->addAdjacent(context.territoryMap[adjacentName]);
+            const string& adjacentName = tokens[i];
+            auto adjacent = context.territoryMap.find(adjacentName);
+            if (adjacent != context.territoryMap.end()) {
+                rawPointer->addAdjacent(adjacent->second);
             } else {
                 // Adjacent territory not yet created, add to waiting list
                 context.waitingTerritories[adjacentName].push_back(rawPointer);
@@ -258,6 +244,77 @@ namespace {
         }
     }
 
+    /**
+     * @brief Parses a territory definition line from a map file
+     * @param line Raw line from map file containing territory definition
+     * @param context Parsing context for state management and deferred resolution
+     * @param mapOutput Target map to add the parsed territory to
+     * @throws std::runtime_error if line format is invalid (< 4 tokens required)
+     * @see addTerritoryTokens()
+     */
+    static void parseTerritories(const string& line, ParseContext& context, Map& mapOutput){
+        addTerritoryTokens(csvParse(line), line, context, mapOutput);
+    }
+
+    /**
+     * @brief Parses a run of consecutive territory lines, in parallel when the run is large
+     * @param lines Trimmed territory lines, in file order
+     * @param context Parsing context for state management and deferred resolution
+     * @param mapOutput Target map to add the parsed territories to
+     *
+     * @throws std::runtime_error on the first invalid line (in file order), like parseTerritories()
+     *
+     * @details Small runs are parsed line by line. Large runs (generated maps with 10^5+ territories)
+     * are split into line-aligned chunks that worker threads tokenize and turn into Territory objects
+     * concurrently; ids are known up front because they are dense and assigned in file order.
+     * A sequential merge then replays addTerritoryTokens() over the chunks in file order, so name
+     * resolution, forward references (waitingTerritories) and adjacency order are exactly those
+     * of the single-threaded parser.
+     *
+     * @complexity O(L) work for L characters; the tokenizing share runs on up to
+     *             hardware_concurrency() threads, the O(T + E) merge runs on the calling thread.
+     */
+    static void parseTerritoryLines(const vector<string>& lines, ParseContext& context, Map& mapOutput){
+        const size_t lineCount = lines.size();
+        const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        const size_t chunkCount = std::min(hardwareThreads, lineCount / MIN_LINES_PER_CHUNK);
+
+        if (lineCount < PARALLEL_PARSE_MIN_LINES || chunkCount < 2) {
+            for (const string& line : lines) parseTerritories(line, context, mapOutput);
+            return;
+        }
+
+        // Per-line buffers filled by the workers; each worker owns a disjoint line range
+        vector<vector<string>> tokens(lineCount);
+        vector<std::unique_ptr<Territory>> territories(lineCount);
+        const int firstId = context.nextTerritoryId;
+
+        auto parseChunk = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                tokens[i] = csvParse(lines[i]);
+                if (tokens[i].size() >= 4) { // invalid lines are reported by the merge, in order
+                    territories[i] = std::make_unique<Territory>(firstId + static_cast<int>(i), tokens[i][0]);
+                }
+            }
+        };
+
+        vector<std::thread> workers;
+        workers.reserve(chunkCount - 1);
+        const size_t chunkSize = (lineCount + chunkCount - 1) / chunkCount;
+        for (size_t begin = chunkSize; begin < lineCount; begin += chunkSize) {
+            workers.emplace_back(parseChunk, begin, std::min(begin + chunkSize, lineCount));
+        }
+        parseChunk(0, std::min(chunkSize, lineCount)); // the calling thread takes the first chunk
+        for (std::thread& worker : workers) worker.join();
+
+        // Deterministic merge in file order
+        mapOutput.reserveTerritories(mapOutput.getTerritories().size() + lineCount);
+        context.territoryMap.reserve(context.territoryMap.size() + lineCount);
+        for (size_t i = 0; i < lineCount; ++i) {
+            addTerritoryTokens(tokens[i], lines[i], context, mapOutput, std::move(territories[i]));
+        }
+    }
+
     /**
      * @brief Performs depth-first search to verify connectivity of territory subgraph
      * @param start Starting territory for the traversal
@@ -354,9 +411,21 @@ namespace {
     }
 }
 
+// ======================= AdjacencyReport =======================
+bool AdjacencyReport::changed() const {
+    return duplicates > 0 || selfLoops > 0 || nullEntries > 0 || oneWayEdges > 0;
+}
+
+ostream& operator<<(ostream& os, const AdjacencyReport& report) {
+    os << report.duplicates << " duplicate(s), " << report.selfLoops << " self-loop(s), "
+       << report.nullEntries << " null pointer(s), " << report.oneWayEdges << " one-way edge(s) mirrored; "
+       << report.edges << " undirected edges";
+    return os;
+}
+
 // ======================= Territory =======================
 /** @brief Default constructor creates empty territory with zero values */
-Territory::Territory() : id(0), name(""), continents(), owner(nullptr), armies(0) {}
+Territory::Territory() : id(0), originalId(0), name(""), x(0), y(0), continents(), owner(nullptr), armies(0), adjacentsSorted(true), version(0), neighbourMaskComplete(true), symmetricAdjacency(false) {}
 
 /**
  * @brief Copy constructor with intentional shallow copy of relationships
@@ -375,11 +444,18 @@ Territory::Territory() : id(0), name(""), continents(), owner(nullptr), armies(0
  */
 Territory::Territory(const Territory& other)
     : id(other.id),
+      originalId(other.originalId),
       name(other.name),
+      x(other.x),
+      y(other.y),
       continents(),              // Intentionally empty - Map copy will rebuild continent links
       owner(other.owner),        // Non-owning pointer - safe to shallow copy
       armies(other.armies),
-      adjacentTerritories()      // Intentionally empty - Map copy will rebuild adjacencies
+      adjacentTerritories(),     // Intentionally empty - Map copy will rebuild adjacencies
+      adjacentsSorted(true),
+      version(0),
+      neighbourMaskComplete(true),
+      symmetricAdjacency(false)  // Map copy restores it with the adjacencies
 {}
 
 /**
@@ -389,8 +465,8 @@ Territory::Territory(const Territory& other)
  * @param owner Player who owns this territory (can be nullptr)
  * @param armies Number of armies stationed in this territory
  */
-Territory::Territory(int id, const string& name, Player* owner, int armies)
-    : id(id), name(name), continents(), owner(owner), armies(armies) {}
+Territory::Territory(int id, const string& name, Player* owner, ArmyCount armies)
+    : id(id), originalId(id), name(name), x(0), y(0), continents(), owner(owner), armies(Armies::clamp(armies)), adjacentsSorted(true), version(0), neighbourMaskComplete(true), symmetricAdjacency(false) {}
 
 /**
  * @brief Parameterized constructor with basic initialization
@@ -398,10 +474,16 @@ Territory::Territory(int id, const string& name, Player* owner, int armies)
  * @param name Name of the territory
  */
 Territory::Territory(int id, const string& name)
-    : id(id), name(name), continents(), owner(nullptr), armies(0) {}
-
-/** @brief Destructor - no cleanup needed as Territory doesn't own its relationships */
-Territory::~Territory() {}
+    : id(id), originalId(id), name(name), x(0), y(0), continents(), owner(nullptr), armies(0), adjacentsSorted(true), version(0), neighbourMaskComplete(true), symmetricAdjacency(false) {}
+
+/** @brief Destructor - Territory doesn't own its relationships; listeners are told it is gone */
+Territory::~Territory() {
+    std::vector<TerritoryListener*> notified;
+    notified.swap(listeners); // a listener may detach itself while being notified
+    for (TerritoryListener* listener : notified) {
+        listener->territoryDestroyed(*this);
+    }
+}
 
 /**
  * @brief Copy assignment operator with intentional shallow copy of relationships
@@ -421,7 +503,10 @@ Territory::~Territory() {}
 Territory& Territory::operator=(const Territory& other) {
     if (this != &other) {
         id = other.id;
+        originalId = other.originalId;
         name = other.name;
+        x = other.x;
+        y = other.y;
         owner = other.owner;
         armies = other.armies;
 
@@ -429,6 +514,11 @@ Territory& Territory::operator=(const Territory& other) {
         // Map-level operations will rebuild these relationships appropriately
         continents.clear(); // Remove old continent memberships
         adjacentTerritories.clear(); // Remove old territory adjacencies
+        adjacentsSorted = true;
+        neighbourMask.clear();
+        neighbourMaskComplete = true;
+        symmetricAdjacency = false;
+        ++version;
     }
     return *this;
 }
@@ -471,8 +561,33 @@ ostream& operator<<(ostream& os, const Territory& territory) {
 /** @brief Get the unique identifier of this territory */
 int Territory::getId() const { return id; }
 
+/** @brief Get the id the territory had when its map was loaded (file order), whatever its current id */
+int Territory::getOriginalId() const { return originalId; }
+
+/**
+ * @brief Give the territory a new id (the original id is kept)
+ * @details Neighbour and continent masks of other objects still hold the old id; the caller
+ *          (Map::renumberForLocality()) rebuilds them.
+ */
+void Territory::renumber(int newId) {
+    id = newId;
+    ++version;
+}
+
 /** @brief Get the name of this territory */
-string Territory::getName() const { return name; }
+const string& Territory::getName() const { return name; }
+
+/** @brief Horizontal coordinate from the map file */
+int Territory::getX() const { return x; }
+
+/** @brief Vertical coordinate from the map file */
+int Territory::getY() const { return y; }
+
+/** @brief Set the coordinates read from the map file */
+void Territory::setCoordinates(int newX, int newY) {
+    x = newX;
+    y = newY;
+}
 
 /** @brief Get the player who owns this territory */
 Player* Territory::getOwner() const { return owner; }
@@ -489,30 +604,109 @@ void Territory::addContinent(Continent* c) {
 void Territory::clearContinents() { continents.clear(); }
 
 /** @brief Get the number of armies stationed in this territory */
-int Territory::getArmies() const { return armies; }
+ArmyCount Territory::getArmies() const { return armies; }
 
 /** @brief Set the owner of this territory */
-void Territory::setOwner(Player* newOwner) { owner = newOwner; }
+void Territory::setOwner(Player* newOwner) {
+    Player* previousOwner = owner;
+    owner = newOwner;
+    if (previousOwner == newOwner) return;
+    ++version;
+    notifyListeners(previousOwner, armies);
+}
 
-/** @brief Set the number of armies in this territory */
-void Territory::setArmies(int newArmies) { armies = newArmies; }
+/** @brief Set the number of armies in this territory (clamped to [0, Armies::MAX]) */
+void Territory::setArmies(ArmyCount newArmies) {
+    const ArmyCount previousArmies = armies;
+    armies = Armies::clamp(newArmies);
+    if (previousArmies == armies) return;
+    ++version;
+    notifyListeners(owner, previousArmies);
+}
 
-/** @brief Add armies to this territory */
-void Territory::addArmies(int additionalArmies) { armies += additionalArmies; }
+/** @brief Add armies to this territory (saturates at Armies::MAX) */
+void Territory::addArmies(ArmyCount additionalArmies) { setArmies(Armies::add(armies, additionalArmies)); }
 
-/** @brief Remove armies from this territory */
-void Territory::removeArmies(int removedArmies) { armies -= removedArmies; }
+/** @brief Remove armies from this territory (stops at 0) */
+void Territory::removeArmies(ArmyCount removedArmies) { setArmies(Armies::subtract(armies, removedArmies)); }
 
-/** @brief Add an adjacent territory */
-void Territory::addAdjacent(Territory* t) { adjacentTerritories.push_back(t); }
+/**
+ * @brief Add an adjacent territory
+ * @details Appending in increasing id order (as the Map copy does) keeps the list sorted. An edge
+ * that t does not list back makes the adjacency of both ends no longer known symmetric.
+ */
+void Territory::addAdjacent(Territory* t) {
+    adjacentsSorted = adjacentsSorted && t != nullptr &&
+                      (adjacentTerritories.empty() || adjacentTerritories.back()->getId() < t->getId());
+    adjacentTerritories.push_back(t);
+    if (t && t->getId() >= 0 && t->getId() < TerritoryBitset::MAX_MASKED_ID) neighbourMask.set(t->getId());
+    else if (t) neighbourMaskComplete = false;
+    if (!t || !t->isAdjacentTo(this)) {
+        symmetricAdjacency = false;
+        if (t && t->symmetricAdjacency) {
+            t->symmetricAdjacency = false;
+            ++t->version; // its cached validations assumed symmetry
+        }
+    }
+    ++version;
+}
+
+/** @brief Clear all adjacent territories (the neighbours that listed this one lose their symmetry) */
+void Territory::clearAdjacents() {
+    for (Territory* adj : adjacentTerritories) {
+        if (adj && adj->symmetricAdjacency) {
+            adj->symmetricAdjacency = false;
+            ++adj->version;
+        }
+    }
+    adjacentTerritories.clear();
+    adjacentsSorted = true;
+    neighbourMask.clear();
+    neighbourMaskComplete = true;
+    symmetricAdjacency = false;
+    ++version;
+}
+
+/**
+ * @brief Sort the neighbours by id and drop duplicate, self-referencing and null entries
+ * @param report Counters of the removed entries (accumulated)
+ * @complexity O(d log d) for d listed neighbours
+ */
+void Territory::normalizeAdjacents(AdjacencyReport& report) {
+    vector<Territory*> kept;
+    kept.reserve(adjacentTerritories.size());
+    for (Territory* adj : adjacentTerritories) {
+        if (adj == nullptr) ++report.nullEntries;
+        else if (adj == this) ++report.selfLoops;
+        else kept.push_back(adj);
+    }
 
-/** @brief Clear all adjacent territories */
-void Territory::clearAdjacents() { adjacentTerritories.clear(); }
+    std::sort(kept.begin(), kept.end(), [](const Territory* a, const Territory* b) {
+        return a->getId() != b->getId() ? a->getId() < b->getId() : std::less<const Territory*>()(a, b);
+    });
+    const auto last = std::unique(kept.begin(), kept.end());
+    report.duplicates += static_cast<int>(kept.end() - last);
+    kept.erase(last, kept.end());
+
+    adjacentTerritories.swap(kept);
+    ++version;
+    neighbourMask.clear();
+    neighbourMaskComplete = true;
+    for (const Territory* adj : adjacentTerritories) {
+        if (adj->getId() >= 0 && adj->getId() < TerritoryBitset::MAX_MASKED_ID) neighbourMask.set(adj->getId());
+        else neighbourMaskComplete = false;
+    }
+    adjacentsSorted = true;
+    for (std::size_t i = 1; i < adjacentTerritories.size() && adjacentsSorted; ++i) {
+        adjacentsSorted = adjacentTerritories[i - 1]->getId() < adjacentTerritories[i]->getId();
+    }
+}
 
 /**
  * @brief Check if this territory is adjacent to another territory
  * @param t Territory to check adjacency with
  * @return true if territories are adjacent, false otherwise
+ * @complexity O(log d) when the neighbours are sorted by id, O(d) otherwise
  */
 bool Territory::isAdjacentTo(const Territory* t) const {
     if (t == nullptr) {
@@ -521,6 +715,11 @@ bool Territory::isAdjacentTo(const Territory* t) const {
 
     // Check if the territory is in the adjacent list
     const int idToFind = t->getId(); // Compare by ID to avoid pointer issues
+    if (adjacentsSorted) {
+        auto it = std::lower_bound(adjacentTerritories.begin(), adjacentTerritories.end(), idToFind,
+                                   [](const Territory* adj, int id) { return adj->getId() < id; });
+        return it != adjacentTerritories.end() && (*it)->getId() == idToFind;
+    }
     return any_of(adjacentTerritories.begin(), adjacentTerritories.end(),
                        [idToFind](const Territory* adj) {
                            return adj != nullptr && adj->getId() == idToFind;
@@ -530,10 +729,54 @@ bool Territory::isAdjacentTo(const Territory* t) const {
 /** @brief Get the list of adjacent territories */
 const vector<Territory*>& Territory::getAdjacents() const { return adjacentTerritories; }
 
+/**
+ * @brief Version of the territory's owner, armies and neighbours
+ * @return Counter bumped by every change of them; used by the order validation cache
+ */
+std::uint64_t Territory::getVersion() const { return version; }
+
+/**
+ * @brief Neighbour ids as a bitset, for word-parallel set tests
+ * @return nullptr when a neighbour id is beyond TerritoryBitset::MAX_MASKED_ID (use getAdjacents())
+ */
+const TerritoryBitset* Territory::getNeighbourMask() const {
+    return neighbourMaskComplete ? &neighbourMask : nullptr;
+}
+
+/**
+ * @brief Whether the neighbours of this territory are exactly the territories that list it
+ * @return true after Map::normalizeAdjacency() (or a copy of a normalized map) until an edge is
+ *         added one way or a neighbour list is cleared; false when unknown
+ */
+bool Territory::hasSymmetricAdjacency() const { return symmetricAdjacency; }
+
+/** @brief Start notifying a listener of owner/army changes (a listener is added once) */
+void Territory::addListener(TerritoryListener* listener) {
+    if (listener && std::find(listeners.begin(), listeners.end(), listener) == listeners.end()) {
+        listeners.push_back(listener);
+    }
+}
+
+/** @brief Stop notifying a listener */
+void Territory::removeListener(TerritoryListener* listener) {
+    listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+}
+
+/** @brief Tell every listener the state before the change (the territory already holds the new state) */
+void Territory::notifyListeners(Player* previousOwner, ArmyCount previousArmies) const {
+    for (TerritoryListener* listener : listeners) {
+        listener->territoryChanged(*this, previousOwner, previousArmies);
+    }
+}
+
+TerritoryListener::~TerritoryListener() = default;
+
+void TerritoryListener::territoryDestroyed(const Territory& territory) { (void)territory; }
+
 // ======================= Continent =======================
 
 /** @brief Default constructor creates empty continent with zero values */
-Continent::Continent() : id(0), name(""), bonus(0), territories() {}
+Continent::Continent() : id(0), name(""), bonus(0), territories(), territoryMaskComplete(true) {}
 
 /**
  * @brief Copy constructor with intentional shallow copy of territory relationships
@@ -543,7 +786,7 @@ Continent::Continent() : id(0), name(""), bonus(0), territories() {}
  * This is intentional as Map copy constructor will rebuild these links.
  */
 Continent::Continent(const Continent& other)
-    : id(other.id), name(other.name), bonus(other.bonus), territories() {
+    : id(other.id), name(other.name), bonus(other.bonus), territories(), territoryMaskComplete(true) {
 }
 
 /**
@@ -552,7 +795,7 @@ Continent::Continent(const Continent& other)
  * @param name Name of the continent
  */
 Continent::Continent(int id, const string& name)
-    : id(id), name(name), bonus(0), territories() {}
+    : id(id), name(name), bonus(0), territories(), territoryMaskComplete(true) {}
 
 /**
  * @brief Parameterized constructor with id, name, and bonus
@@ -561,7 +804,7 @@ Continent::Continent(int id, const string& name)
  * @param bonus Army bonus for controlling this continent
  */
 Continent::Continent(int id, const string& name, int bonus)
-    : id(id), name(name), bonus(bonus), territories() {}
+    : id(id), name(name), bonus(bonus), territories(), territoryMaskComplete(true) {}
 
 /** @brief Destructor - no cleanup needed as Continent doesn't own territories */
 Continent::~Continent() {}
@@ -580,6 +823,8 @@ Continent& Continent::operator=(const Continent& other) {
         name = other.name;
         bonus = other.bonus;
         territories.clear(); // Clear existing territories
+        territoryMask.clear();
+        territoryMaskComplete = true;
         // No deep copy of territories as Map copy will rebuild these links
     }
     return *this;
@@ -589,7 +834,7 @@ Continent& Continent::operator=(const Continent& other) {
 int Continent::getId() const { return id; }
 
 /** @brief Get the name of this continent */
-string Continent::getName() const { return name; }
+const string& Continent::getName() const { return name; }
 
 /** @brief Get the army bonus for controlling this continent */
 int Continent::getBonus() const { return bonus; }
@@ -598,14 +843,31 @@ int Continent::getBonus() const { return bonus; }
 void Continent::setBonus(int bonus) { this->bonus = bonus; }
 
 /** @brief Add a territory to this continent */
-void Continent::addTerritory(Territory* territory) { territories.push_back(territory); }
+void Continent::addTerritory(Territory* territory) {
+    territories.push_back(territory);
+    if (!territory) return;
+    if (territory->getId() >= 0 && territory->getId() < TerritoryBitset::MAX_MASKED_ID) territoryMask.set(territory->getId());
+    else territoryMaskComplete = false;
+}
 
 /** @brief Remove all territories from this continent */
-void Continent::clearTerritories() { territories.clear(); }
+void Continent::clearTerritories() {
+    territories.clear();
+    territoryMask.clear();
+    territoryMaskComplete = true;
+}
 
 /** @brief Get the list of territories in this continent */
 const vector<Territory*>& Continent::getTerritories() const { return territories; }
 
+/**
+ * @brief Member ids as a bitset, for word-parallel set tests
+ * @return nullptr when a member id is beyond TerritoryBitset::MAX_MASKED_ID (use getTerritories())
+ */
+const TerritoryBitset* Continent::getTerritoryMask() const {
+    return territoryMaskComplete ? &territoryMask : nullptr;
+}
+
 /**
  * @brief Stream insertion operator for Continent
  * @param os Output stream
@@ -633,7 +895,7 @@ ostream& operator<<(ostream& os, const Continent& continent) {
 // ======================= Map =======================
 
 /** @brief Default constructor creates empty map */
-Map::Map() : territories(), continents() {}
+Map::Map() : territories(), continents(), metadata() {}
 
 /**
  * @brief Copy constructor performs deep copy of territories and continents
@@ -645,7 +907,7 @@ Map::Map() : territories(), continents() {}
  * - Territory-continent relationships
  * - Territory adjacency relationships
  */
-Map::Map(const Map& other) : territories(), continents() {
+Map::Map(const Map& other) : territories(), continents(), metadata(other.metadata) {
 
     // Build lookup of continent pointers in map for easy reference
     unordered_map<const Continent*, Continent*> continentMap; // Maps original continent pointers to new cloned pointers
@@ -654,7 +916,7 @@ Map::Map(const Map& other) : territories(), continents() {
     // Clone continents name and id first
     for (const Continent* c : other.continents) {
         if (c) {
-            Continent* newContinent = new Continent(c->getId(), c->getName());
+            Continent* newContinent = new Continent(c->getId(), c->getName(), c->getBonus());
             continents.push_back(newContinent);
             continentMap[c] = newContinent; // record in map for looking up later
         }
@@ -668,7 +930,9 @@ Map::Map(const Map& other) : territories(), continents() {
     // Clone basic territory info next
     for (const Territory* t : other.territories) {
         if (t) {
-            Territory* newTerritory = new Territory(t->getId(), t->getName(), t->getOwner(), t->getArmies());
+            Territory* newTerritory = new Territory(t->getOriginalId(), t->getName(), t->getOwner(), t->getArmies());
+            newTerritory->renumber(t->getId());
+            newTerritory->setCoordinates(t->getX(), t->getY());
             territories.push_back(newTerritory);
             territoryMap[t] = newTerritory; // record in map for looking up later
         }
@@ -696,6 +960,11 @@ Map::Map(const Map& other) : territories(), continents() {
             }
         }
     }
+    for (const Territory* oldTerritory : other.territories) { // same adjacency, same symmetry
+        if (oldTerritory && territoryMap[oldTerritory]) {
+            territoryMap[oldTerritory]->symmetricAdjacency = oldTerritory->symmetricAdjacency;
+        }
+    }
 }
 
 /**
@@ -724,6 +993,7 @@ void swap(Map& a, Map& b) noexcept {
     using std::swap;
     swap(a.territories, b.territories);
     swap(a.continents,  b.continents);
+    swap(a.metadata,    b.metadata);
 }
 
 /**
@@ -762,6 +1032,187 @@ void Map::addContinent(Continent* c) {
     continents.push_back(c); // Add continent to collection, taking ownership
 }
 
+/**
+ * @brief Reserve room for territories ahead of a bulk insert
+ * @param count Total number of territories the map is expected to hold
+ */
+void Map::reserveTerritories(std::size_t count) {
+    territories.reserve(count);
+}
+
+/**
+ * @brief Make the adjacency of every territory sorted, duplicate-free and symmetric
+ * @return What was fixed, plus the number of undirected edges afterwards
+ *
+ * @details Each list is sorted by id and cleaned, then every edge A->B is checked against the
+ * sorted list of B (binary search); missing reverse edges are added and the touched lists are
+ * sorted again. Total cost O(E log E) for E listed edges.
+ */
+AdjacencyReport Map::normalizeAdjacency() {
+    AdjacencyReport report;
+    for (Territory* t : territories) {
+        if (t) t->normalizeAdjacents(report);
+    }
+
+    vector<std::pair<Territory*, Territory*>> missing; // (territory, neighbour to add)
+    for (Territory* t : territories) {
+        if (!t) continue;
+        for (Territory* adj : t->getAdjacents()) {
+            if (!adj->isAdjacentTo(t)) missing.emplace_back(adj, t);
+        }
+    }
+    for (const auto& edge : missing) edge.first->addAdjacent(edge.second);
+    report.oneWayEdges = static_cast<int>(missing.size());
+
+    AdjacencyReport resort; // second pass only re-sorts, nothing left to remove
+    int listed = 0;
+    for (Territory* t : territories) {
+        if (!t) continue;
+        t->normalizeAdjacents(resort);
+        t->symmetricAdjacency = true;
+        listed += static_cast<int>(t->getAdjacents().size());
+    }
+    report.edges = listed / 2;
+    return report;
+}
+
+/**
+ * @brief Check, without changing any list, that every listed edge is mirrored
+ * @return true if so; the territories then report hasSymmetricAdjacency() as after normalizeAdjacency()
+ * @complexity O(E log d) for E listed edges (O(E d) for unsorted lists)
+ */
+bool Map::confirmSymmetricAdjacency() {
+    for (const Territory* t : territories) {
+        if (!t) continue;
+        for (const Territory* adj : t->getAdjacents()) {
+            if (!adj || adj == t || !adj->isAdjacentTo(t)) return false;
+        }
+    }
+    for (Territory* t : territories) {
+        if (t) t->symmetricAdjacency = true;
+    }
+    return true;
+}
+
+namespace {
+    /** @brief Largest and mean id difference across the listed edges of a map */
+    void measureLocality(const vector<Territory*>& territories, int& bandwidth, double& meanGap) {
+        long long gaps = 0;
+        long long edges = 0;
+        bandwidth = 0;
+        for (const Territory* t : territories) {
+            for (const Territory* adj : t->getAdjacents()) {
+                const int gap = std::abs(t->getId() - adj->getId());
+                bandwidth = std::max(bandwidth, gap);
+                gaps += gap;
+                ++edges;
+            }
+        }
+        meanGap = edges ? static_cast<double>(gaps) / static_cast<double>(edges) : 0.0;
+    }
+}
+
+/**
+ * @brief Renumber the territories so that neighbours get close ids, and store them in that order
+ * @return Bandwidth and mean id gap across edges, before and after
+ * @throws std::logic_error if a territory already has an owner (players keep id masks)
+ *
+ * @details Reverse Cuthill-McKee: every connected component is traversed breadth-first from a
+ * low-degree territory, visiting the neighbours of a territory by increasing degree, and the
+ * visit order is reversed. Territory i of the new order gets the i-th smallest of the current
+ * ids, so the id range is unchanged; getOriginalId() still returns the file-order id.
+ *
+ * The territories are then re-allocated in the new order (copy of the map), so that the
+ * Territory objects, and every array indexed by id or by position in getTerritories(), follow
+ * the traversal order of neighbour walks. Adjacency lists are normalized again (sorted by new id).
+ *
+ * Run it right after loading: listeners, owners and pointers held on the old territories do not
+ * survive it.
+ * @complexity O(V + E log d) for the traversal, plus the O(V + E) copy and normalization
+ */
+RenumberReport Map::renumberForLocality() {
+    RenumberReport report;
+    measureLocality(territories, report.bandwidthBefore, report.meanGapBefore);
+    for (const Territory* t : territories) {
+        if (t->getOwner()) throw std::logic_error("renumberForLocality() must run before territories are assigned");
+    }
+
+    const std::size_t count = territories.size();
+    unordered_map<const Territory*, std::size_t> indexOf;
+    indexOf.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) indexOf[territories[i]] = i;
+    auto degree = [&](std::size_t i) { return territories[i]->getAdjacents().size(); };
+
+    vector<std::size_t> byDegree(count);
+    for (std::size_t i = 0; i < count; ++i) byDegree[i] = i;
+    std::stable_sort(byDegree.begin(), byDegree.end(),
+                     [&](std::size_t a, std::size_t b) { return degree(a) < degree(b); });
+
+    vector<std::size_t> order;
+    order.reserve(count);
+    vector<char> visited(count, 0);
+    vector<std::size_t> neighbours;
+    for (std::size_t start : byDegree) {
+        if (visited[start]) continue;
+        visited[start] = 1;
+        order.push_back(start);
+        for (std::size_t next = order.size() - 1; next < order.size(); ++next) {
+            neighbours.clear();
+            for (const Territory* adj : territories[order[next]]->getAdjacents()) {
+                auto it = indexOf.find(adj);
+                if (it != indexOf.end() && !visited[it->second]) {
+                    visited[it->second] = 1;
+                    neighbours.push_back(it->second);
+                }
+            }
+            std::stable_sort(neighbours.begin(), neighbours.end(),
+                             [&](std::size_t a, std::size_t b) { return degree(a) < degree(b); });
+            order.insert(order.end(), neighbours.begin(), neighbours.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+
+    vector<int> ids(count);
+    for (std::size_t i = 0; i < count; ++i) ids[i] = territories[i]->getId();
+    std::sort(ids.begin(), ids.end());
+    vector<Territory*> renumbered(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        renumbered[i] = territories[order[i]];
+        renumbered[i]->renumber(ids[i]);
+    }
+    territories.swap(renumbered);
+
+    Map relocated(*this); // allocates the territories in the new order and rebuilds every mask
+    swap(*this, relocated);
+    normalizeAdjacency();
+
+    measureLocality(territories, report.bandwidthAfter, report.meanGapAfter);
+    return report;
+}
+
+/**
+ * @brief Territories in the order of the map file (original ids), whatever the current numbering
+ * @details Saved games and other per-territory records use this order so that they do not depend
+ *          on whether the map was renumbered. O(V) when the map was not renumbered.
+ */
+vector<Territory*> Map::getTerritoriesInFileOrder() const {
+    vector<Territory*> inFileOrder(territories);
+    auto byOriginalId = [](const Territory* a, const Territory* b) { return a->getOriginalId() < b->getOriginalId(); };
+    if (!std::is_sorted(inFileOrder.begin(), inFileOrder.end(), byOriginalId)) {
+        std::sort(inFileOrder.begin(), inFileOrder.end(), byOriginalId);
+    }
+    return inFileOrder;
+}
+
+/**
+ * @brief Stream insertion operator for RenumberReport
+ */
+ostream& operator<<(ostream& os, const RenumberReport& report) {
+    os << "bandwidth " << report.bandwidthBefore << " -> " << report.bandwidthAfter
+       << ", mean neighbour id gap " << report.meanGapBefore << " -> " << report.meanGapAfter;
+    return os;
+}
+
 /** @brief Get the list of all territories in this map */
 const vector<Territory*>& Map::getTerritories() const { return territories; }
 
@@ -786,6 +1237,17 @@ void Map::clear() {
         delete continent;
     }
     continents.clear();
+    metadata.clear();
+}
+
+/** @brief Record a "key=value" line of the [Map] section (kept for MapWriter::writeConquest()) */
+void Map::addMetadata(const string& line) {
+    metadata.push_back(line);
+}
+
+/** @brief Lines of the [Map] section, in file order */
+const vector<string>& Map::getMetadata() const {
+    return metadata;
 }
 
 /**
@@ -902,14 +1364,8 @@ ostream& operator<<(ostream& os, const MapLoader& ml) {
  * @return Vector of map file paths as strings
  */
 vector<string> MapLoader::getMapFiles() {
-    vector<string> mapFiles;
-
-    // List and sort .map files
-    for (const fs::path& p : listMapFiles(fs::path(MAP_PATH))) {
-        mapFiles.push_back(p.string());
-    }
-
-    return mapFiles;
+    // Listing is answered by the map index (sorted by filename, refreshed by mtime/hash)
+    return MapIndex::forDefaultDirectory().getMapFiles();
 }
 
 /**
@@ -929,7 +1385,15 @@ void MapLoader::printMapFiles(const vector<string>& mapFiles) {
             break;
         }
         fs::path p{mapFiles[i]}; // Extract filename from full path
-        cout << i + 1 << ". " << p.filename().string() << endl; // Display only the filename
+        cout << i + 1 << ". " << p.filename().string(); // Display only the filename
+
+        // Summarize the map from the index without opening the .map file
+        const MapIndexEntry* entry = MapIndex::forDefaultDirectory().find(p.filename().string());
+        if (entry) {
+            cout << " (" << entry->territoryCount << " territories, " << entry->continentCount
+                 << " continents" << (entry->valid ? "" : ", invalid") << ")";
+        }
+        cout << endl;
     }
 }
 
@@ -938,8 +1402,31 @@ void MapLoader::printMapFiles(const vector<string>& mapFiles) {
  * @param filename Path to the .map file to load
  * @param mapOutput Reference to Map object to populate
  * @return true if map loaded successfully, false otherwise
+ *
+ * @details A map of the default directory whose index entry points to a packed archive is decoded
+ * from the (already mapped) archive when the archive holds the current contents of the file;
+ * any other map is parsed from its text.
  */
 bool MapLoader::loadMap(const string& filename, Map& mapOutput) {
+    const fs::path p = filename;
+    MapIndex& index = MapIndex::forDefaultDirectory();
+    if (p.parent_path() == fs::path(index.getDirectory())) {
+        const MapIndexEntry* entry = index.find(p.filename().string());
+        if (entry && !entry->cachePath.empty() &&
+            MapArchive::shared(entry->cachePath).load(entry->fileName, entry->contentHash, mapOutput)) {
+            return true;
+        }
+    }
+    return parseMapFile(filename, mapOutput);
+}
+
+/**
+ * @brief Parse a .map file and normalize its adjacency
+ * @param filename Path to the .map file to parse
+ * @param mapOutput Reference to Map object to populate
+ * @return true if map loaded successfully, false otherwise
+ */
+bool MapLoader::parseMapFile(const string& filename, Map& mapOutput) {
     fs::path p = filename;
 
     ifstream mapInput(p);
@@ -950,6 +1437,11 @@ bool MapLoader::loadMap(const string& filename, Map& mapOutput) {
     MapLoader::parseMapFileSections(mapInput, mapOutput);
     mapInput.close();
 
+    const AdjacencyReport fixed = mapOutput.normalizeAdjacency();
+    if (fixed.changed()) {
+        cout << "Normalized adjacency of " << p.filename().string() << ": " << fixed << endl;
+    }
+
     return true;
 }
 
@@ -959,6 +1451,10 @@ void MapLoader::parseMapFileSections(istream& mapInput, Map& mapOutput) {
 
     ParseContext context;  // Local variable on the stack
 
+    // Consecutive [Territories] lines are buffered and parsed as one run (possibly in parallel),
+    // flushed before any other section is processed so continent lookups see the same state.
+    vector<string> territoryLines;
+
     // Read the file line by line
     string line;
     while(getline(mapInput, line)){
@@ -971,6 +1467,9 @@ void MapLoader::parseMapFileSections(istream& mapInput, Map& mapOutput) {
 
         // Detect section headers
         if(trimmedLine.front() == '[' && trimmedLine.back() == ']'){
+            parseTerritoryLines(territoryLines, context, mapOutput);
+            territoryLines.clear();
+
             string section = trimmedLine.substr(1, trimmedLine.size()-2);
 
             if (section == "Map")               currentSection = MapFileSections::Map;
@@ -983,18 +1482,19 @@ void MapLoader::parseMapFileSections(istream& mapInput, Map& mapOutput) {
         // Process section content here based on currentSection
         switch(currentSection) {
             case MapFileSections::Map:
-                continue; // Ignore metadata parse in [Map] section   
+                mapOutput.addMetadata(trimmedLine); // kept verbatim, not interpreted
                 break;
             case MapFileSections::Continents:
                 parseContinents(trimmedLine, context, mapOutput);
                 break;
             case MapFileSections::Territories:
-                parseTerritories(trimmedLine, context, mapOutput);
+                territoryLines.push_back(std::move(trimmedLine));
                 break;
             case MapFileSections::None:
                 // Unknown section, skip
                 break;
         }
     }
+    parseTerritoryLines(territoryLines, context, mapOutput);
 }
 
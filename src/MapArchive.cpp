@@ -0,0 +1,406 @@
+/**
+ * @file MapArchive.cpp
+ * @brief Packed map archive: writer, memory-mapped reader and map decoding.
+ *
+ * Archive layout (native byte order, all offsets in bytes from the start of the file):
+ *   header  : magic[8] "WZPACK\0\1", u32 version, u32 byte-order mark, u32 map count, u32 reserved,
+ *             u64 index offset
+ *   blobs   : one per map (see below), back to back
+ *   names   : file names of the maps, back to back
+ *   index   : one record per map, sorted by file name:
+ *             u64 content hash, u64 blob offset, u64 blob size, u32 name offset, u32 name length
+ *
+ * Map blob (offsets of names are relative to the blob's string table):
+ *   u32 continents, u32 territories, u32 adjacency entries, u32 string table bytes, u32 metadata lines
+ *   continents  : i32 id, i32 bonus, u32 name offset, u32 name length
+ *   territories : i32 id, i32 continent index (-1 if none), u32 name offset, u32 name length,
+ *                 i32 x, i32 y, u32 end of its neighbours in the adjacency array
+ *   metadata    : u32 offset, u32 length of every [Map] section line
+ *   adjacency   : u32 territory index of every neighbour, grouped by territory, sorted by id
+ *   strings     : continent and territory names, metadata lines
+ */
+
+#include "../include/MapArchive.h"
+#include "../include/Map.h"
+#include "../include/MapIndex.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+using std::vector;
+
+const char* const MapArchive::ARCHIVE_EXTENSION = ".pack";
+
+/** @brief Anonymous namespace containing the binary layout and its encoding helpers */
+namespace {
+    const char MAGIC[8] = {'W', 'Z', 'P', 'A', 'C', 'K', '\0', '\1'};
+    const std::uint32_t VERSION = 2; // 2: coordinates and [Map] section lines
+    const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    const std::size_t HEADER_SIZE = 32;
+    const std::size_t INDEX_RECORD_SIZE = 32;
+    const std::size_t BLOB_HEADER_SIZE = 20;
+    const std::size_t CONTINENT_RECORD_SIZE = 16;
+    const std::size_t TERRITORY_RECORD_SIZE = 28;
+    const std::size_t TERRITORY_END_OFFSET = 24; // neighbour end within a territory record
+    const std::size_t METADATA_RECORD_SIZE = 8;
+
+    void put32(string& out, std::uint32_t value) { out.append(reinterpret_cast<const char*>(&value), 4); }
+    void put64(string& out, std::uint64_t value) { out.append(reinterpret_cast<const char*>(&value), 8); }
+
+    std::uint32_t read32(const unsigned char* p) {
+        std::uint32_t value;
+        std::memcpy(&value, p, 4);
+        return value;
+    }
+
+    std::uint64_t read64(const unsigned char* p) {
+        std::uint64_t value;
+        std::memcpy(&value, p, 8);
+        return value;
+    }
+
+    /** @brief Append a name to a string table and write its (offset, length) pair */
+    void putName(string& record, string& strings, const string& name) {
+        put32(record, static_cast<std::uint32_t>(strings.size()));
+        put32(record, static_cast<std::uint32_t>(name.size()));
+        strings += name;
+    }
+
+    /**
+     * @brief Encode a parsed (normalized) map as one archive blob
+     * @complexity O(territories + continents + adjacency entries)
+     */
+    string encodeMap(const Map& map) {
+        const vector<Continent*>& continents = map.getContinents();
+        const vector<Territory*>& territories = map.getTerritories();
+
+        std::unordered_map<const Continent*, std::uint32_t> continentIndex;
+        std::unordered_map<const Territory*, std::uint32_t> territoryIndex;
+        for (std::size_t i = 0; i < continents.size(); ++i) continentIndex[continents[i]] = static_cast<std::uint32_t>(i);
+        for (std::size_t i = 0; i < territories.size(); ++i) territoryIndex[territories[i]] = static_cast<std::uint32_t>(i);
+
+        string records;
+        string adjacency;
+        string strings;
+        for (const Continent* c : continents) {
+            put32(records, static_cast<std::uint32_t>(c->getId()));
+            put32(records, static_cast<std::uint32_t>(c->getBonus()));
+            putName(records, strings, c->getName());
+        }
+
+        std::uint32_t adjacencyCount = 0;
+        for (const Territory* t : territories) {
+            std::int32_t continent = -1;
+            if (!t->getContinents().empty()) {
+                auto it = continentIndex.find(t->getContinents().front());
+                if (it != continentIndex.end()) continent = static_cast<std::int32_t>(it->second);
+            }
+            for (const Territory* adj : t->getAdjacents()) {
+                auto it = territoryIndex.find(adj);
+                if (it == territoryIndex.end()) continue; // not part of this map
+                put32(adjacency, it->second);
+                ++adjacencyCount;
+            }
+            put32(records, static_cast<std::uint32_t>(t->getId()));
+            put32(records, static_cast<std::uint32_t>(continent));
+            putName(records, strings, t->getName());
+            put32(records, static_cast<std::uint32_t>(t->getX()));
+            put32(records, static_cast<std::uint32_t>(t->getY()));
+            put32(records, adjacencyCount);
+        }
+        for (const string& line : map.getMetadata()) putName(records, strings, line);
+
+        string blob;
+        put32(blob, static_cast<std::uint32_t>(continents.size()));
+        put32(blob, static_cast<std::uint32_t>(territories.size()));
+        put32(blob, adjacencyCount);
+        put32(blob, static_cast<std::uint32_t>(strings.size()));
+        put32(blob, static_cast<std::uint32_t>(map.getMetadata().size()));
+        return blob + records + adjacency + strings;
+    }
+
+    /**
+     * @brief Check that every count, name and index of a blob stays inside the blob
+     * @return true if the blob can be decoded safely
+     */
+    bool blobIsConsistent(const unsigned char* blob, std::uint64_t size) {
+        if (size < BLOB_HEADER_SIZE) return false;
+        const std::uint64_t continents = read32(blob);
+        const std::uint64_t territories = read32(blob + 4);
+        const std::uint64_t adjacency = read32(blob + 8);
+        const std::uint64_t stringBytes = read32(blob + 12);
+        const std::uint64_t metadata = read32(blob + 16);
+        if (BLOB_HEADER_SIZE + continents * CONTINENT_RECORD_SIZE + territories * TERRITORY_RECORD_SIZE +
+            metadata * METADATA_RECORD_SIZE + adjacency * 4 + stringBytes != size) return false;
+
+        const unsigned char* p = blob + BLOB_HEADER_SIZE;
+        for (std::uint64_t c = 0; c < continents; ++c, p += CONTINENT_RECORD_SIZE) {
+            if (std::uint64_t(read32(p + 8)) + read32(p + 12) > stringBytes) return false;
+        }
+        std::uint32_t previousEnd = 0;
+        for (std::uint64_t t = 0; t < territories; ++t, p += TERRITORY_RECORD_SIZE) {
+            const std::int32_t continent = static_cast<std::int32_t>(read32(p + 4));
+            if (continent < -1 || (continent >= 0 && std::uint64_t(continent) >= continents)) return false;
+            if (std::uint64_t(read32(p + 8)) + read32(p + 12) > stringBytes) return false;
+            const std::uint32_t end = read32(p + TERRITORY_END_OFFSET);
+            if (end < previousEnd || end > adjacency) return false;
+            previousEnd = end;
+        }
+        if (previousEnd != adjacency) return false;
+        for (std::uint64_t m = 0; m < metadata; ++m, p += METADATA_RECORD_SIZE) {
+            if (std::uint64_t(read32(p)) + read32(p + 4) > stringBytes) return false;
+        }
+        for (std::uint64_t a = 0; a < adjacency; ++a, p += 4) {
+            if (read32(p) >= territories) return false;
+        }
+        return true;
+    }
+}
+
+// ======================= MapArchive =======================
+
+/**
+ * @brief Map an archive file into memory
+ * @param path Archive file; a missing, foreign or corrupt file leaves the archive closed
+ */
+MapArchive::MapArchive(const string& path) : path(path), data(nullptr), size(0), mapCount(0) {
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(HEADER_SIZE)) {
+        void* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            data = static_cast<const unsigned char*>(mapped);
+            size = static_cast<std::size_t>(info.st_size);
+        }
+    }
+    ::close(fd); // the mapping stays valid without the descriptor
+#endif
+    if (!data) return;
+
+    const std::uint64_t indexOffset = read64(data + 24);
+    const std::uint64_t count = read32(data + 16);
+    const bool valid = std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0 && read32(data + 8) == VERSION &&
+                       read32(data + 12) == BYTE_ORDER_MARK && indexOffset <= size &&
+                       count <= (size - indexOffset) / INDEX_RECORD_SIZE;
+    if (valid) {
+        mapCount = static_cast<std::size_t>(count);
+    } else {
+#if !defined(_WIN32)
+        ::munmap(const_cast<unsigned char*>(data), size);
+#endif
+        data = nullptr;
+        size = 0;
+    }
+}
+
+/** @brief Destructor - unmaps the archive */
+MapArchive::~MapArchive() {
+#if !defined(_WIN32)
+    if (data) ::munmap(const_cast<unsigned char*>(data), size);
+#endif
+}
+
+/**
+ * @brief Archive shared by every loader of the process
+ * @param path Archive file
+ * @return Archive mapped on the first call for this path (possibly closed if the file is unusable)
+ */
+MapArchive& MapArchive::shared(const string& path) {
+    static std::map<string, std::unique_ptr<MapArchive>> archives;
+    std::unique_ptr<MapArchive>& archive = archives[path];
+    if (!archive) archive.reset(new MapArchive(path));
+    return *archive;
+}
+
+/**
+ * @brief Pack every map of an index that parses into the archive next to its directory
+ * @param index Index of the map directory (refreshed first)
+ * @return Number of maps written
+ * @throws std::runtime_error if the archive cannot be written
+ *
+ * @details The archive is written to a temporary file and renamed, so archives already mapped by
+ * running processes stay valid. Each packed entry gets the archive as its cache path.
+ */
+int MapArchive::pack(MapIndex& index) {
+    index.refresh();
+    const string archivePath = index.getDirectory() + ARCHIVE_EXTENSION;
+
+    struct Packed {
+        const MapIndexEntry* entry;
+        string blob;
+    };
+    vector<Packed> packed;
+    MapLoader loader;
+    for (const MapIndexEntry& e : index.getEntries()) {
+        Map map;
+        try {
+            loader.parseMapFile(index.getDirectory() + "/" + e.fileName, map);
+        } catch (const std::exception&) {
+            continue; // unreadable or malformed: left to the text loader
+        }
+        packed.push_back(Packed{&e, encodeMap(map)});
+    }
+
+    string header(MAGIC, sizeof(MAGIC));
+    put32(header, VERSION);
+    put32(header, BYTE_ORDER_MARK);
+    put32(header, static_cast<std::uint32_t>(packed.size()));
+    put32(header, 0);
+
+    std::uint64_t offset = HEADER_SIZE;
+    string blobs;
+    string names;
+    string records;
+    for (const Packed& p : packed) {
+        put64(records, p.entry->contentHash);
+        put64(records, offset + blobs.size());
+        put64(records, p.blob.size());
+        blobs += p.blob;
+    }
+    const std::uint64_t namesOffset = offset + blobs.size();
+    string indexRecords;
+    for (std::size_t i = 0; i < packed.size(); ++i) {
+        indexRecords.append(records, i * 24, 24);
+        put32(indexRecords, static_cast<std::uint32_t>(namesOffset + names.size()));
+        put32(indexRecords, static_cast<std::uint32_t>(packed[i].entry->fileName.size()));
+        names += packed[i].entry->fileName;
+    }
+    put64(header, namesOffset + names.size());
+
+    const string temporaryPath = archivePath + ".tmp";
+    {
+        std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Cannot write map archive: " + temporaryPath);
+        out << header << blobs << names << indexRecords;
+        if (!out) throw std::runtime_error("Cannot write map archive: " + temporaryPath);
+    }
+    if (std::rename(temporaryPath.c_str(), archivePath.c_str()) != 0) {
+        std::remove(temporaryPath.c_str());
+        throw std::runtime_error("Cannot replace map archive: " + archivePath);
+    }
+
+    for (const Packed& p : packed) index.setCachePath(p.entry->fileName, archivePath);
+    return static_cast<int>(packed.size());
+}
+
+bool MapArchive::isOpen() const { return data != nullptr; }
+std::size_t MapArchive::getMapCount() const { return mapCount; }
+const string& MapArchive::getPath() const { return path; }
+
+/**
+ * @brief Locate the blob of a map
+ * @return Start of the blob, or nullptr if the name is absent or was packed from other contents
+ * @complexity O(log maps), binary search over the index in the mapping
+ */
+const unsigned char* MapArchive::findBlob(const string& fileName, std::uint64_t contentHash,
+                                          std::uint64_t& blobSize) const {
+    if (!data) return nullptr;
+    const unsigned char* records = data + read64(data + 24);
+
+    auto nameOf = [this, records](std::size_t i) {
+        const unsigned char* r = records + i * INDEX_RECORD_SIZE;
+        const std::uint64_t offset = read32(r + 24);
+        const std::uint64_t length = read32(r + 28);
+        if (offset + length > size) return std::string_view();
+        return std::string_view(reinterpret_cast<const char*>(data + offset), static_cast<std::size_t>(length));
+    };
+
+    std::size_t low = 0;
+    std::size_t high = mapCount;
+    while (low < high) {
+        const std::size_t mid = low + (high - low) / 2;
+        if (nameOf(mid) < std::string_view(fileName)) low = mid + 1;
+        else high = mid;
+    }
+    if (low == mapCount || nameOf(low) != std::string_view(fileName)) return nullptr;
+
+    const unsigned char* r = records + low * INDEX_RECORD_SIZE;
+    const std::uint64_t offset = read64(r + 8);
+    blobSize = read64(r + 16);
+    if (read64(r) != contentHash || offset > size || blobSize > size - offset) return nullptr;
+    return data + offset;
+}
+
+/**
+ * @brief Build a map from its packed form
+ * @param fileName File name of the map (e.g. "World.map")
+ * @param contentHash Hash of the current file contents (a stale entry is not used)
+ * @param mapOutput Map receiving the continents and territories (nothing is added on failure)
+ * @return true if the map was read from the archive
+ */
+bool MapArchive::load(const string& fileName, std::uint64_t contentHash, Map& mapOutput) const {
+    std::uint64_t blobSize = 0;
+    const unsigned char* blob = findBlob(fileName, contentHash, blobSize);
+    if (!blob || !blobIsConsistent(blob, blobSize)) return false;
+
+    const std::uint32_t continentCount = read32(blob);
+    const std::uint32_t territoryCount = read32(blob + 4);
+    const std::uint32_t adjacencyCount = read32(blob + 8);
+    const std::uint32_t metadataCount = read32(blob + 16);
+    const unsigned char* continentRecords = blob + BLOB_HEADER_SIZE;
+    const unsigned char* territoryRecords = continentRecords + continentCount * CONTINENT_RECORD_SIZE;
+    const unsigned char* metadataRecords = territoryRecords + territoryCount * TERRITORY_RECORD_SIZE;
+    const unsigned char* adjacency = metadataRecords + metadataCount * METADATA_RECORD_SIZE;
+    const char* strings = reinterpret_cast<const char*>(adjacency + adjacencyCount * 4);
+
+    vector<Continent*> continents(continentCount);
+    for (std::uint32_t c = 0; c < continentCount; ++c) {
+        const unsigned char* r = continentRecords + c * CONTINENT_RECORD_SIZE;
+        continents[c] = new Continent(static_cast<std::int32_t>(read32(r)), string(strings + read32(r + 8), read32(r + 12)),
+                                      static_cast<std::int32_t>(read32(r + 4)));
+        mapOutput.addContinent(continents[c]);
+    }
+
+    vector<Territory*> territories(territoryCount);
+    mapOutput.reserveTerritories(mapOutput.getTerritories().size() + territoryCount);
+    for (std::uint32_t t = 0; t < territoryCount; ++t) {
+        const unsigned char* r = territoryRecords + t * TERRITORY_RECORD_SIZE;
+        territories[t] = new Territory(static_cast<std::int32_t>(read32(r)), string(strings + read32(r + 8), read32(r + 12)));
+        territories[t]->setCoordinates(static_cast<std::int32_t>(read32(r + 16)), static_cast<std::int32_t>(read32(r + 20)));
+        mapOutput.addTerritory(territories[t]);
+        const std::int32_t continent = static_cast<std::int32_t>(read32(r + 4));
+        if (continent >= 0) {
+            territories[t]->addContinent(continents[continent]);
+            continents[continent]->addTerritory(territories[t]);
+        }
+    }
+
+    std::uint32_t begin = 0;
+    for (std::uint32_t t = 0; t < territoryCount; ++t) {
+        const std::uint32_t end = read32(territoryRecords + t * TERRITORY_RECORD_SIZE + TERRITORY_END_OFFSET);
+        for (std::uint32_t a = begin; a < end; ++a) territories[t]->addAdjacent(territories[read32(adjacency + a * 4)]);
+        begin = end;
+    }
+    mapOutput.confirmSymmetricAdjacency(); // archived maps were normalized when packed
+
+    for (std::uint32_t m = 0; m < metadataCount; ++m) {
+        const unsigned char* r = metadataRecords + m * METADATA_RECORD_SIZE;
+        mapOutput.addMetadata(string(strings + read32(r), read32(r + 4)));
+    }
+    return true;
+}
+
+std::ostream& operator<<(std::ostream& os, const MapArchive& archive) {
+    os << "MapArchive [" << archive.path << ", maps: " << archive.mapCount << ", bytes: " << archive.size
+       << (archive.isOpen() ? "" : ", closed") << "]";
+    return os;
+}
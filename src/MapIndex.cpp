@@ -0,0 +1,374 @@
+/**
+ * @file MapIndex.cpp
+ * @brief Implementation of the map directory metadata index.
+ *
+ * Index file format (tab separated, one map per line, '#' starts a comment):
+ *   <file> <name> <territories> <continents> <undirected edges> <valid> <mtime> <size> <hash> <cachePath>
+ * The hash is written in hexadecimal. Lines that fail to parse are dropped and rebuilt on refresh.
+ */
+
+#include "../include/MapIndex.h"
+#include "../include/Map.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+using std::string;
+using std::vector;
+using std::runtime_error;
+
+/** @brief Anonymous namespace containing directory scanning and hashing helpers */
+namespace {
+    const string INDEX_HEADER = "# Warzone map index v3"; // v2: counts after adjacency normalization, v3: undirected edges
+    const string INDEX_EXTENSION = ".index";
+
+    /**
+     * @brief Lists all .map files in a directory sorted alphabetically by filename
+     * @param dir Path to directory containing map files
+     * @return Vector of file paths sorted by filename
+     * @throws std::runtime_error if directory doesn't exist or isn't accessible
+     * @complexity O(n log n) where n is the number of .map files (due to sorting)
+     */
+    vector<fs::path> listMapFiles(const fs::path& dir) {
+        vector<fs::path> mapFiles;
+
+        // Validate directory existence and accessibility
+        if (!fs::exists(dir) || !fs::is_directory(dir)) {
+            throw runtime_error("Map directory does not exist or is not a directory: " + dir.string());
+        }
+
+        // Scan directory for .map files, filtering out non-regular files
+        for (const fs::directory_entry& fileEntry : fs::directory_iterator(dir)) {
+            if (fileEntry.is_regular_file() && fileEntry.path().extension() == ".map") {
+                mapFiles.push_back(fileEntry.path());
+            }
+        }
+
+        // Sort alphabetically by filename for consistent user experience
+        sort(mapFiles.begin(), mapFiles.end(), [](const fs::path& a, const fs::path& b){
+            return a.filename().string() < b.filename().string();
+        });
+
+        return mapFiles;
+    }
+
+    /**
+     * @brief FNV-1a hash of a file's contents
+     * @param path File to hash
+     * @return 64-bit hash (hash of the empty input if the file cannot be read)
+     * @complexity O(file size)
+     */
+    std::uint64_t hashFile(const fs::path& path) {
+        std::uint64_t h = 1469598103934665603ULL;
+        std::ifstream in(path, std::ios::binary);
+        char buffer[1 << 14];
+        while (in) {
+            in.read(buffer, sizeof(buffer));
+            const std::streamsize got = in.gcount();
+            for (std::streamsize i = 0; i < got; ++i) {
+                h ^= static_cast<unsigned char>(buffer[i]);
+                h *= 1099511628211ULL;
+            }
+        }
+        return h;
+    }
+
+    /** @brief Last write time of a file as a plain integer (0 if it cannot be read) */
+    long long modificationTime(const fs::path& path) {
+        std::error_code ec;
+        const fs::file_time_type time = fs::last_write_time(path, ec);
+        return ec ? 0 : static_cast<long long>(time.time_since_epoch().count());
+    }
+
+    /**
+     * @brief Parse and validate a map file to fill in its index entry
+     * @param path Map file to index
+     * @param entry Entry whose file name, mtime, size and hash are already set
+     */
+    void indexMapFile(const fs::path& path, MapIndexEntry& entry) {
+        entry.displayName = path.stem().string();
+        entry.territoryCount = 0;
+        entry.continentCount = 0;
+        entry.edgeCount = 0;
+        entry.valid = false;
+
+        MapLoader loader;
+        Map map;
+        try {
+            loader.parseMapFile(path.string(), map);
+        } catch (const std::exception&) {
+            return; // unreadable or malformed: indexed as invalid
+        }
+
+        entry.territoryCount = static_cast<int>(map.getTerritories().size());
+        entry.continentCount = static_cast<int>(map.getContinents().size());
+        int listed = 0; // each undirected edge is listed by both ends once normalized
+        for (const Territory* t : map.getTerritories()) {
+            if (t) listed += static_cast<int>(t->getAdjacents().size());
+        }
+        entry.edgeCount = listed / 2;
+        entry.valid = map.validate();
+    }
+
+    /** @brief Ordering of entries by file name (the index is kept sorted) */
+    bool entryLess(const MapIndexEntry& entry, const string& fileName) {
+        return entry.fileName < fileName;
+    }
+}
+
+// ======================= MapIndex =======================
+
+const char* const MapIndex::DEFAULT_MAP_DIRECTORY = "assets/maps";
+
+/** @brief Default constructor indexes the default map directory */
+MapIndex::MapIndex() : MapIndex(DEFAULT_MAP_DIRECTORY) {}
+
+/**
+ * @brief Construct an index for a map directory
+ * @param mapDirectory Directory containing the .map files; the index is stored as <mapDirectory>.index
+ */
+MapIndex::MapIndex(const string& mapDirectory)
+    : directory(mapDirectory), indexPath(), fresh(false), entries() {
+    // Strip trailing separators so "assets/maps/" and "assets/maps" share one index file
+    while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\')) {
+        directory.pop_back();
+    }
+    indexPath = directory + INDEX_EXTENSION;
+}
+
+/** @brief Copy constructor */
+MapIndex::MapIndex(const MapIndex& other) = default;
+
+/** @brief Destructor - the index file is written by refresh(), nothing to flush here */
+MapIndex::~MapIndex() {}
+
+/** @brief Copy assignment operator */
+MapIndex& MapIndex::operator=(const MapIndex& other) {
+    if (this != &other) {
+        directory = other.directory;
+        indexPath = other.indexPath;
+        fresh = other.fresh;
+        entries = other.entries;
+    }
+    return *this;
+}
+
+/** @brief Stream insertion operator prints one line per indexed map */
+std::ostream& operator<<(std::ostream& os, const MapIndex& index) {
+    os << "MapIndex [" << index.directory << ", " << index.entries.size() << " maps]\n";
+    for (const MapIndexEntry& e : index.entries) {
+        os << "  " << e.fileName << ": " << e.territoryCount << " territories, "
+           << e.continentCount << " continents, " << e.edgeCount << " undirected edges, "
+           << (e.valid ? "valid" : "invalid") << "\n";
+    }
+    return os;
+}
+
+/**
+ * @brief Shared index of the default map directory
+ * @return Process-wide MapIndex for assets/maps
+ */
+MapIndex& MapIndex::forDefaultDirectory() {
+    static MapIndex index;
+    return index;
+}
+
+/**
+ * @brief Rescan the directory and bring the index up to date
+ * @return true if any entry was added, removed or re-indexed
+ * @throws std::runtime_error if the directory does not exist
+ *
+ * @details Unchanged files (same mtime and size) cost one stat. Files whose mtime changed are
+ *          hashed; only files whose content actually changed are parsed and validated again.
+ *          The index file is rewritten when something changed.
+ */
+bool MapIndex::refresh() {
+    const vector<fs::path> files = listMapFiles(fs::path(directory));
+
+    bool changed = files.size() != entries.size();
+    vector<MapIndexEntry> updated;
+    updated.reserve(files.size());
+
+    for (const fs::path& path : files) {
+        const string fileName = path.filename().string();
+        const long long mtime = modificationTime(path);
+        std::error_code ec;
+        const std::uintmax_t size = fs::file_size(path, ec);
+
+        auto it = std::lower_bound(entries.begin(), entries.end(), fileName, entryLess);
+        const MapIndexEntry* old = (it != entries.end() && it->fileName == fileName) ? &*it : nullptr;
+
+        if (old && old->mtime == mtime && old->fileSize == size) {
+            updated.push_back(*old);
+            continue;
+        }
+
+        MapIndexEntry entry = old ? *old : MapIndexEntry();
+        entry.fileName = fileName;
+        entry.mtime = mtime;
+        entry.fileSize = size;
+
+        const std::uint64_t hash = hashFile(path);
+        if (!old || old->contentHash != hash) {
+            entry.contentHash = hash;
+            entry.cachePath.clear(); // the compiled cache belonged to the old contents
+            indexMapFile(path, entry);
+        }
+        updated.push_back(entry);
+        changed = true;
+    }
+
+    entries.swap(updated);
+    fresh = true;
+    if (changed) save();
+    return changed;
+}
+
+/** @brief Load the index file and rescan the directory the first time the index is used */
+void MapIndex::ensureFresh() {
+    if (fresh) return;
+    load();
+    refresh();
+}
+
+/**
+ * @brief Look up a map by file name
+ * @param fileName File name relative to the map directory (e.g. "World.map")
+ * @return Entry of the map, or nullptr if no such map exists
+ * @complexity O(log n), plus one rescan if the file appeared after the last refresh
+ */
+const MapIndexEntry* MapIndex::find(const string& fileName) {
+    try {
+        ensureFresh();
+
+        auto it = std::lower_bound(entries.begin(), entries.end(), fileName, entryLess);
+        if (it != entries.end() && it->fileName == fileName) return &*it;
+
+        // The map may have been added since the last refresh
+        const fs::path path = fs::path(directory) / fileName;
+        std::error_code ec;
+        if (path.extension() == ".map" && fs::is_regular_file(path, ec)) {
+            refresh();
+            it = std::lower_bound(entries.begin(), entries.end(), fileName, entryLess);
+            if (it != entries.end() && it->fileName == fileName) return &*it;
+        }
+    } catch (const std::exception&) {
+        // Missing map directory: nothing can be found
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Get all indexed maps
+ * @return Entries sorted by file name (empty if the directory does not exist)
+ */
+const vector<MapIndexEntry>& MapIndex::getEntries() {
+    try {
+        ensureFresh();
+    } catch (const std::exception&) {
+        entries.clear();
+    }
+    return entries;
+}
+
+/**
+ * @brief Get the paths of all maps in the directory
+ * @return Full paths sorted by file name
+ * @throws std::runtime_error if the directory does not exist
+ */
+vector<string> MapIndex::getMapFiles() {
+    ensureFresh();
+
+    vector<string> mapFiles;
+    mapFiles.reserve(entries.size());
+    for (const MapIndexEntry& e : entries) {
+        mapFiles.push_back((fs::path(directory) / e.fileName).string());
+    }
+    return mapFiles;
+}
+
+/**
+ * @brief Record where the compiled cache of a map lives
+ * @param fileName Map file name relative to the directory
+ * @param cachePath Path of the compiled cache ("" to forget it)
+ */
+void MapIndex::setCachePath(const string& fileName, const string& cachePath) {
+    auto it = std::lower_bound(entries.begin(), entries.end(), fileName, entryLess);
+    if (it == entries.end() || it->fileName != fileName || it->cachePath == cachePath) return;
+    it->cachePath = cachePath;
+    save();
+}
+
+/**
+ * @brief Read the index file
+ * @return true if the file was read, false if it does not exist or has another format version
+ */
+bool MapIndex::load() {
+    entries.clear();
+
+    std::ifstream in(indexPath);
+    if (!in) return false;
+
+    string line;
+    if (!std::getline(in, line) || line != INDEX_HEADER) return false; // stale format: rebuild
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        vector<string> fields;
+        std::istringstream ss(line);
+        string field;
+        while (std::getline(ss, field, '\t')) fields.push_back(field);
+        if (fields.size() == 9) fields.push_back(""); // empty trailing cache path
+        if (fields.size() != 10) continue;
+
+        MapIndexEntry e;
+        try {
+            e.fileName = fields[0];
+            e.displayName = fields[1];
+            e.territoryCount = std::stoi(fields[2]);
+            e.continentCount = std::stoi(fields[3]);
+            e.edgeCount = std::stoi(fields[4]);
+            e.valid = fields[5] == "1";
+            e.mtime = std::stoll(fields[6]);
+            e.fileSize = std::stoull(fields[7]);
+            e.contentHash = std::stoull(fields[8], nullptr, 16);
+            e.cachePath = fields[9];
+        } catch (const std::exception&) {
+            continue; // corrupt line: the map is re-indexed on refresh
+        }
+        entries.push_back(e);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const MapIndexEntry& a, const MapIndexEntry& b) {
+        return a.fileName < b.fileName;
+    });
+    return true;
+}
+
+/**
+ * @brief Write the index file
+ * @return true on success (a read-only checkout simply keeps the index in memory)
+ */
+bool MapIndex::save() const {
+    std::ofstream out(indexPath, std::ios::trunc);
+    if (!out) return false;
+
+    out << INDEX_HEADER << "\n";
+    for (const MapIndexEntry& e : entries) {
+        out << e.fileName << '\t' << e.displayName << '\t' << e.territoryCount << '\t'
+            << e.continentCount << '\t' << e.edgeCount << '\t' << (e.valid ? 1 : 0) << '\t'
+            << e.mtime << '\t' << e.fileSize << '\t' << std::hex << e.contentHash << std::dec << '\t'
+            << e.cachePath << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+/** @brief Get the indexed directory */
+const string& MapIndex::getDirectory() const { return directory; }
+
+/** @brief Get the path of the index file */
+const string& MapIndex::getIndexPath() const { return indexPath; }
@@ -0,0 +1,159 @@
+/**
+ * @file MapPrefetcher.cpp
+ * @brief Background loading and validation of tournament maps (see MapPrefetcher.h).
+ */
+
+#include <chrono>
+#include <exception>
+#include <ostream>
+#include <stdexcept>
+#include "../include/MapPrefetcher.h"
+
+/**
+ * @brief Start preparing the maps of a tournament
+ * @param mapNames Maps in tournament order (file names relative to assets/maps/)
+ * @param gamesPerMap Games played on each map
+ * @param renumber Renumber each map for locality after loading it
+ * @param profile Measure the loads and validations with performance counters
+ * @param depth Maximum number of prepared maps waiting to be taken (at least 1)
+ */
+MapPrefetcher::MapPrefetcher(const std::vector<std::string>& mapNames, int gamesPerMap, bool renumber,
+                             bool profile, std::size_t depth)
+    : mapNames(mapNames),
+      gamesPerMap(gamesPerMap),
+      renumber(renumber),
+      profile(profile),
+      depth(depth < 1 ? 1 : depth),
+      finished(false),
+      stopping(false),
+      waitMilliseconds(0.0),
+      handedOut(0) {
+    stage = std::thread(&MapPrefetcher::run, this);
+}
+
+/** @brief Stop the stage thread and delete the prepared maps that were not taken */
+MapPrefetcher::~MapPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taken.notify_all();
+    if (stage.joinable()) stage.join();
+    for (PreparedMap& prepared : queue) delete prepared.map;
+}
+
+/**
+ * @brief Take the map of the next game, in tournament order
+ * @return The prepared map; the caller owns `map`
+ * @throws std::logic_error if every game was already handed out
+ */
+PreparedMap MapPrefetcher::next() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (queue.empty() && !finished) {
+        const auto start = std::chrono::steady_clock::now();
+        ready.wait(lock, [this] { return !queue.empty() || finished; });
+        waitMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    if (queue.empty()) throw std::logic_error("MapPrefetcher: every game was already handed out");
+
+    PreparedMap prepared = std::move(queue.front());
+    queue.pop_front();
+    ++handedOut;
+    lock.unlock();
+    taken.notify_one();
+    return prepared;
+}
+
+/** @brief Time next() spent waiting for the stage thread */
+double MapPrefetcher::getWaitMilliseconds() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return waitMilliseconds;
+}
+
+/** @brief Number of prepared maps taken so far */
+std::size_t MapPrefetcher::getPrepared() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return handedOut;
+}
+
+/** @brief Counters of the loads and validations done so far (empty when profiling is off) */
+PhaseProfile MapPrefetcher::getProfile() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stageProfile;
+}
+
+/**
+ * @brief Queue a prepared map, waiting while the queue is full
+ * @return false if the prefetcher is stopping (the map was deleted)
+ */
+bool MapPrefetcher::push(PreparedMap prepared) {
+    std::unique_lock<std::mutex> lock(mutex);
+    taken.wait(lock, [this] { return stopping || queue.size() < depth; });
+    if (stopping) {
+        delete prepared.map;
+        return false;
+    }
+    queue.push_back(std::move(prepared));
+    lock.unlock();
+    ready.notify_one();
+    return true;
+}
+
+/**
+ * @brief Stage thread: load, renumber and validate each map once, then queue a copy per game
+ * @details A map that fails to load is queued once per game with its error and no map, so the
+ *          simulation reports every game of that map as it did when it loaded the maps itself.
+ */
+void MapPrefetcher::run() {
+    MapLoader loader;
+    for (const std::string& mapName : mapNames) {
+        PreparedMap base;
+        base.mapName = mapName;
+        Map pristine;
+        PhaseProfile measured;
+        try {
+            {
+                PerfScope scope(profile ? &measured : nullptr, PerfPhase::LoadMap);
+                loader.loadMap("assets/maps/" + mapName, pristine);
+            }
+            if (renumber) {
+                base.report = pristine.renumberForLocality();
+                base.renumbered = true;
+            }
+            PerfScope scope(profile ? &measured : nullptr, PerfPhase::ValidateMap);
+            base.valid = pristine.validate();
+        } catch (const std::exception& e) {
+            base.error = e.what();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stageProfile += measured;
+        }
+
+        for (int g = 0; g < gamesPerMap; ++g) {
+            PreparedMap prepared = base;
+            prepared.game = g;
+            if (base.error.empty()) {
+                try {
+                    prepared.map = new Map(pristine);
+                } catch (const std::exception& e) {
+                    prepared.error = e.what();
+                }
+            }
+            if (!push(std::move(prepared))) return;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+    }
+    ready.notify_all();
+}
+
+/** @brief Print the progress of the prefetcher */
+std::ostream& operator<<(std::ostream& os, const MapPrefetcher& prefetcher) {
+    std::lock_guard<std::mutex> lock(prefetcher.mutex);
+    return os << "MapPrefetcher(" << prefetcher.handedOut << " maps taken, depth " << prefetcher.depth
+              << ", simulation waited " << prefetcher.waitMilliseconds << " ms)";
+}
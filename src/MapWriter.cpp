@@ -0,0 +1,236 @@
+/**
+ * @file MapWriter.cpp
+ * @brief Conquest and JSON writers over a to_chars-based output buffer (see MapWriter.h).
+ */
+
+#include <charconv>
+#include <ostream>
+#include "../include/MapWriter.h"
+#include "../include/Map.h"
+#include "../include/Player.h"
+#include "../include/PlayerStrategies.h"
+#include "../include/Cards.h"
+
+// ======================= BufferedWriter =======================
+
+/** @brief Writer appending to out through a BUFFER_SIZE buffer */
+BufferedWriter::BufferedWriter(std::ostream& out) : out(out), buffer(new char[BUFFER_SIZE]), used(0), flushed(0) {}
+
+BufferedWriter::~BufferedWriter() {
+    flush();
+}
+
+/** @brief Hand the buffered bytes to the stream */
+void BufferedWriter::flush() {
+    if (used == 0) return;
+    out.write(buffer.get(), static_cast<std::streamsize>(used));
+    flushed += used;
+    used = 0;
+}
+
+void BufferedWriter::reserve(std::size_t bytes) {
+    if (BUFFER_SIZE - used < bytes) flush();
+}
+
+BufferedWriter& BufferedWriter::put(char c) {
+    reserve(1);
+    buffer[used++] = c;
+    return *this;
+}
+
+/** @brief Append text; text longer than the buffer goes straight to the stream */
+BufferedWriter& BufferedWriter::write(std::string_view text) {
+    if (text.size() > BUFFER_SIZE) {
+        flush();
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        flushed += text.size();
+        return *this;
+    }
+    reserve(text.size());
+    text.copy(buffer.get() + used, text.size());
+    used += text.size();
+    return *this;
+}
+
+/** @brief Append the decimal digits of value (std::to_chars, no locale) */
+BufferedWriter& BufferedWriter::writeInteger(std::int64_t value) {
+    reserve(20); // "-9223372036854775808"
+    const std::to_chars_result result = std::to_chars(buffer.get() + used, buffer.get() + BUFFER_SIZE, value);
+    used = static_cast<std::size_t>(result.ptr - buffer.get());
+    return *this;
+}
+
+/** @brief Append text as a JSON string: quoted, with '"', '\\' and control characters escaped */
+BufferedWriter& BufferedWriter::writeJsonString(std::string_view text) {
+    static const char hex[] = "0123456789abcdef";
+    put('"');
+    std::size_t plain = 0; // start of the run of characters copied as they are
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        const unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        write(text.substr(plain, i - plain));
+        plain = i + 1;
+        switch (c) {
+            case '"':  write("\\\""); break;
+            case '\\': write("\\\\"); break;
+            case '\n': write("\\n"); break;
+            case '\r': write("\\r"); break;
+            case '\t': write("\\t"); break;
+            default: {
+                const char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+                write(std::string_view(escaped, sizeof(escaped)));
+            }
+        }
+    }
+    write(text.substr(plain));
+    return put('"');
+}
+
+std::size_t BufferedWriter::getBytesWritten() const {
+    return flushed + used;
+}
+
+// ======================= MapWriter =======================
+
+namespace {
+    /** @brief First continent of a territory, nullptr if it has none */
+    const Continent* continentOf(const Territory& territory) {
+        const std::vector<Continent*>& continents = territory.getContinents();
+        return continents.empty() ? nullptr : continents.front();
+    }
+
+    /** @brief Append "[id,id,...]" */
+    void writeIdArray(BufferedWriter& out, const std::vector<Territory*>& territories) {
+        out.put('[');
+        bool first = true;
+        for (const Territory* t : territories) {
+            if (!t) continue;
+            if (!first) out.put(',');
+            out.writeInteger(t->getId());
+            first = false;
+        }
+        out.put(']');
+    }
+}
+
+namespace MapWriter {
+
+    /**
+     * @brief Write a map as Conquest .map text
+     * @param map Map to write
+     * @param out Destination stream
+     * @param title Written as "name=<title>" in the [Map] section if the map has no [Map] lines
+     *        of its own and title is not empty
+     */
+    void writeConquest(const Map& map, std::ostream& out, const std::string& title) {
+        BufferedWriter writer(out);
+        writer.write("[Map]\n");
+        for (const std::string& line : map.getMetadata()) writer.write(line).put('\n');
+        if (map.getMetadata().empty() && !title.empty()) writer.write("name=").write(title).put('\n');
+
+        writer.write("\n[Continents]\n");
+        for (const Continent* continent : map.getContinents()) {
+            writer.write(continent->getName()).put('=').writeInteger(continent->getBonus()).put('\n');
+        }
+
+        writer.write("\n[Territories]\n");
+        for (const Territory* territory : map.getTerritoriesInFileOrder()) {
+            const Continent* continent = continentOf(*territory);
+            writer.write(territory->getName()).put(',').writeInteger(territory->getX());
+            writer.put(',').writeInteger(territory->getY()).put(',');
+            if (continent) writer.write(continent->getName());
+            for (const Territory* adjacent : territory->getAdjacents()) {
+                if (adjacent) writer.put(',').write(adjacent->getName());
+            }
+            writer.put('\n');
+        }
+    }
+
+    /** @brief Write a map as one JSON object (see writeJson(const Map&, BufferedWriter&)) */
+    void writeJson(const Map& map, std::ostream& out) {
+        BufferedWriter writer(out);
+        writeJson(map, writer);
+        writer.put('\n');
+    }
+
+    /**
+     * @brief Append a map as one JSON object
+     * @details {"continents":[{"id","name","bonus","territories":[ids]}],
+     *           "territories":[{"id","originalId","name","x","y","continent","owner","armies","adjacent":[ids]}]}
+     *          with null for a missing continent or owner.
+     */
+    void writeJson(const Map& map, BufferedWriter& out) {
+        out.write("{\"continents\":[");
+        bool first = true;
+        for (const Continent* continent : map.getContinents()) {
+            if (!first) out.put(',');
+            out.write("{\"id\":").writeInteger(continent->getId());
+            out.write(",\"name\":").writeJsonString(continent->getName());
+            out.write(",\"bonus\":").writeInteger(continent->getBonus());
+            out.write(",\"territories\":");
+            writeIdArray(out, continent->getTerritories());
+            out.put('}');
+            first = false;
+        }
+
+        out.write("],\"territories\":[");
+        first = true;
+        for (const Territory* territory : map.getTerritories()) {
+            if (!first) out.put(',');
+            const Continent* continent = continentOf(*territory);
+            out.write("{\"id\":").writeInteger(territory->getId());
+            out.write(",\"originalId\":").writeInteger(territory->getOriginalId());
+            out.write(",\"name\":").writeJsonString(territory->getName());
+            out.write(",\"x\":").writeInteger(territory->getX());
+            out.write(",\"y\":").writeInteger(territory->getY());
+            out.write(",\"continent\":");
+            if (continent) out.writeInteger(continent->getId());
+            else out.write("null");
+            out.write(",\"owner\":");
+            if (territory->getOwner()) out.writeJsonString(territory->getOwner()->getPlayerName());
+            else out.write("null");
+            out.write(",\"armies\":").writeInteger(territory->getArmies());
+            out.write(",\"adjacent\":");
+            writeIdArray(out, territory->getAdjacents());
+            out.put('}');
+            first = false;
+        }
+        out.write("]}");
+    }
+
+    /**
+     * @brief Write the state of a game as one JSON object
+     * @param map Board of the game
+     * @param players Players of the game (the Neutral player appears only as a territory owner)
+     * @param state Name of the engine state
+     * @param turn Current turn (0 outside of the game loop)
+     * @param out Destination stream
+     */
+    void writeGameStateJson(const Map& map, const std::vector<Player*>& players, const std::string& state,
+                            int turn, std::ostream& out) {
+        BufferedWriter writer(out);
+        writer.write("{\"state\":").writeJsonString(state);
+        writer.write(",\"turn\":").writeInteger(turn);
+        writer.write(",\"map\":");
+        writeJson(map, writer);
+
+        writer.write(",\"players\":[");
+        bool first = true;
+        for (const Player* player : players) {
+            if (!player) continue;
+            if (!first) writer.put(',');
+            const PlayerStrategy* strategy = player->getPlayerStrategy();
+            writer.write("{\"name\":").writeJsonString(player->getPlayerName());
+            writer.write(",\"strategy\":");
+            if (strategy) writer.writeJsonString(strategy->getStrategyName());
+            else writer.write("null");
+            writer.write(",\"territories\":").writeInteger(static_cast<std::int64_t>(player->getTerritoryCount()));
+            writer.write(",\"reinforcementPool\":").writeInteger(player->getReinforcementPool());
+            writer.write(",\"cards\":").writeInteger(player->getPlayerHand()
+                ? static_cast<std::int64_t>(player->getPlayerHand()->getCardsOnHand().size()) : 0);
+            writer.put('}');
+            first = false;
+        }
+        writer.write("]}\n");
+    }
+}
@@ -0,0 +1,309 @@
+/**
+ * @file OpeningBook.cpp
+ * @brief Implementation of the persistent opening book for early-turn bot decisions.
+ *
+ * On-disk format (header line first, then one entry per line, '#' starts a comment):
+ *   <mapHash> <players> <turn> <positionHash> <moveCount> {D <target> <amount> | A <source> <target> <amount>}...
+ * Hashes are written in hexadecimal. Lines that fail to parse are skipped; a file with another
+ * header (an older format) is ignored and replaced on the next save.
+ */
+
+#include "../include/OpeningBook.h"
+#include "../include/Map.h"
+#include "../include/Player.h"
+#include "../include/Cards.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using std::string;
+using std::vector;
+
+/** @brief Anonymous namespace containing hashing helpers */
+namespace {
+    constexpr std::uint64_t FNV_OFFSET = 1469598103934665603ULL;
+    constexpr std::uint64_t FNV_PRIME  = 1099511628211ULL;
+
+    /** @brief Mix the bytes of an integer into a running FNV-1a hash */
+    inline void hashInt(std::uint64_t& h, std::int64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            h ^= static_cast<std::uint64_t>(value >> (i * 8)) & 0xFFu;
+            h *= FNV_PRIME;
+        }
+    }
+
+    /** @brief Mix a string (and its length, to avoid ambiguities) into a running FNV-1a hash */
+    inline void hashString(std::uint64_t& h, const string& s) {
+        hashInt(h, static_cast<std::int64_t>(s.size()));
+        for (unsigned char c : s) {
+            h ^= c;
+            h *= FNV_PRIME;
+        }
+    }
+
+    const string BOOK_HEADER = "# Warzone opening book v2"; // v2: canonical positions, no seat
+}
+
+// ======================= OpeningBookKey =======================
+
+/** @brief Two keys are equal when every component matches */
+bool OpeningBookKey::operator==(const OpeningBookKey& other) const {
+    return mapHash == other.mapHash && playerCount == other.playerCount && turn == other.turn &&
+           positionHash == other.positionHash;
+}
+
+/** @brief Combine all key components into a single bucket hash */
+std::size_t OpeningBookKeyHash::operator()(const OpeningBookKey& key) const {
+    std::uint64_t h = key.positionHash ^ (key.mapHash * FNV_PRIME);
+    hashInt(h, key.playerCount);
+    hashInt(h, key.turn);
+    return static_cast<std::size_t>(h);
+}
+
+// ======================= OpeningBook =======================
+
+/** @brief Default constructor creates an in-memory book that is never persisted */
+OpeningBook::OpeningBook()
+    : path(), depth(DEFAULT_DEPTH), capacity(DEFAULT_CAPACITY), loaded(true), dirty(false), hits(0), misses(0),
+      entries() {}
+
+/**
+ * @brief Construct a book backed by a file
+ * @param path File the book is loaded from (lazily) and saved to
+ * @param depth Number of opening turns the book covers
+ * @param capacity Maximum number of positions kept (loaded or recorded)
+ */
+OpeningBook::OpeningBook(const string& path, int depth, std::size_t capacity)
+    : path(path), depth(depth), capacity(capacity), loaded(false), dirty(false), hits(0), misses(0), entries() {}
+
+/** @brief Copy constructor copies the entries and the backing path */
+OpeningBook::OpeningBook(const OpeningBook& other) = default;
+
+/** @brief Destructor - the book is only persisted through an explicit save() */
+OpeningBook::~OpeningBook() {}
+
+/** @brief Copy assignment operator */
+OpeningBook& OpeningBook::operator=(const OpeningBook& other) {
+    if (this != &other) {
+        path = other.path;
+        depth = other.depth;
+        capacity = other.capacity;
+        loaded = other.loaded;
+        dirty = other.dirty;
+        hits = other.hits;
+        misses = other.misses;
+        entries = other.entries;
+    }
+    return *this;
+}
+
+/** @brief Stream insertion operator prints a one-line summary of the book */
+std::ostream& operator<<(std::ostream& os, const OpeningBook& book) {
+    os << "OpeningBook [" << (book.path.empty() ? string("in-memory") : book.path)
+       << ", entries: " << book.entries.size()
+       << ", hits: " << book.hits << ", misses: " << book.misses << "]";
+    return os;
+}
+
+/**
+ * @brief Hash the static topology of a map
+ * @param map Map to hash
+ * @return 64-bit FNV-1a hash of continents, territory names, memberships and adjacency
+ * @complexity O(V + E)
+ */
+std::uint64_t OpeningBook::hashMap(const Map& map) {
+    std::uint64_t h = FNV_OFFSET;
+    for (const Continent* c : map.getContinents()) {
+        if (!c) continue;
+        hashString(h, c->getName());
+        hashInt(h, c->getBonus());
+    }
+    for (const Territory* t : map.getTerritories()) {
+        if (!t) continue;
+        hashInt(h, t->getId());
+        hashString(h, t->getName());
+        for (const Continent* c : t->getContinents()) {
+            if (c) hashInt(h, c->getId());
+        }
+        for (const Territory* adj : t->getAdjacents()) {
+            if (adj) hashInt(h, adj->getId());
+        }
+    }
+    return h;
+}
+
+/**
+ * @brief Hash the current board canonically, from the point of view of one player
+ * @param map Map being played
+ * @param players Players of the game, in any order
+ * @param player Player whose decisions are being looked up
+ * @param strategyId Opening book id of the player's strategy
+ * @return 64-bit hash of owners, armies, the player's reinforcement pool, hand and strategy
+ *
+ * @details Owners are encoded as 0 for the player itself and 1.. for the other players ranked by
+ * name (-1 for anyone else, e.g. Neutral), so the hash does not depend on the shuffled turn order.
+ * @complexity O(V + P log P + H log H)
+ */
+std::uint64_t OpeningBook::hashPosition(const Map& map, const vector<Player*>& players,
+                                        const Player* player, const string& strategyId) {
+    vector<const Player*> others;
+    for (const Player* p : players) {
+        if (p && p != player) others.push_back(p);
+    }
+    std::stable_sort(others.begin(), others.end(), [](const Player* a, const Player* b) {
+        return a->getPlayerName() < b->getPlayerName();
+    });
+    std::unordered_map<const Player*, std::int64_t> code;
+    code[player] = 0;
+    for (std::size_t i = 0; i < others.size(); ++i) code[others[i]] = static_cast<std::int64_t>(i + 1);
+
+    std::uint64_t h = FNV_OFFSET;
+    for (const Territory* t : map.getTerritories()) {
+        if (!t) continue;
+        auto it = code.find(t->getOwner());
+        hashInt(h, it == code.end() ? -1 : it->second);
+        hashInt(h, t->getArmies());
+    }
+    hashInt(h, player ? player->getReinforcementPool() : 0);
+
+    vector<int> hand; // card types, order-independent
+    if (player && player->getPlayerHand()) {
+        for (const Card* card : player->getPlayerHand()->getCardsOnHand()) {
+            if (card) hand.push_back(static_cast<int>(card->getCard()));
+        }
+    }
+    std::sort(hand.begin(), hand.end());
+    hashInt(h, static_cast<std::int64_t>(hand.size()));
+    for (int type : hand) hashInt(h, type);
+
+    hashString(h, strategyId);
+    return h;
+}
+
+/**
+ * @brief Look up the orders recorded for a position
+ * @param key Position key
+ * @return Pointer to the recorded moves, or nullptr on a miss
+ * @complexity O(1) average (the backing file is read on the first call only)
+ */
+const vector<OpeningBookMove>* OpeningBook::lookup(const OpeningBookKey& key) {
+    if (!loaded) load();
+    if (key.turn > depth) return nullptr;
+
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        ++misses;
+        return nullptr;
+    }
+    ++hits;
+    return &it->second;
+}
+
+/**
+ * @brief Record the orders issued from a position (first recording wins; nothing once full)
+ * @param key Position key
+ * @param moves Orders issued by the strategy, in issue order
+ */
+void OpeningBook::record(const OpeningBookKey& key, const vector<OpeningBookMove>& moves) {
+    if (!loaded) load();
+    if (key.turn > depth || entries.size() >= capacity) return;
+    if (entries.emplace(key, moves).second) {
+        dirty = true;
+    }
+}
+
+/**
+ * @brief Read the backing file, merging its entries into the book (up to the capacity)
+ * @return true if the file was read, false if it does not exist, has another format or no path is set
+ */
+bool OpeningBook::load() {
+    loaded = true;
+    if (path.empty()) return false;
+
+    std::ifstream in(path);
+    if (!in) return false;
+
+    string line;
+    if (!std::getline(in, line) || line != BOOK_HEADER) {
+        dirty = true; // rewrite the file in the current format on the next save
+        return false;
+    }
+    while (entries.size() < capacity && std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream ss(line);
+        OpeningBookKey key;
+        std::size_t moveCount = 0;
+        ss >> std::hex >> key.mapHash >> std::dec >> key.playerCount >> key.turn
+           >> std::hex >> key.positionHash >> std::dec >> moveCount;
+        if (!ss) continue;
+
+        vector<OpeningBookMove> moves;
+        moves.reserve(moveCount);
+        for (std::size_t i = 0; i < moveCount && ss; ++i) {
+            char type = 0;
+            OpeningBookMove move;
+            ss >> type;
+            if (type == 'D') {
+                move.type = OpeningBookMove::Type::Deploy;
+                ss >> move.targetId >> move.amount;
+            } else if (type == 'A') {
+                move.type = OpeningBookMove::Type::Advance;
+                ss >> move.sourceId >> move.targetId >> move.amount;
+            } else {
+                ss.setstate(std::ios::failbit);
+            }
+            if (ss) moves.push_back(move);
+        }
+        if (!ss || moves.size() != moveCount) continue; // skip corrupt lines
+
+        entries.emplace(key, std::move(moves));
+    }
+    return true;
+}
+
+/**
+ * @brief Write the book back to its file if new entries were recorded
+ * @return true if the book is persisted (or nothing needed saving), false on write failure
+ */
+bool OpeningBook::save() {
+    if (path.empty() || !dirty) return true;
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        std::cerr << "ERROR: Could not write opening book to " << path << std::endl;
+        return false;
+    }
+
+    out << BOOK_HEADER << "\n";
+    for (const auto& entry : entries) {
+        const OpeningBookKey& key = entry.first;
+        out << std::hex << key.mapHash << std::dec << ' ' << key.playerCount << ' ' << key.turn << ' ' << std::hex << key.positionHash << std::dec << ' ' << entry.second.size();
+        for (const OpeningBookMove& move : entry.second) {
+            if (move.type == OpeningBookMove::Type::Deploy) {
+                out << " D " << move.targetId << ' ' << move.amount;
+            } else {
+                out << " A " << move.sourceId << ' ' << move.targetId << ' ' << move.amount;
+            }
+        }
+        out << "\n";
+    }
+    dirty = false;
+    return true;
+}
+
+/** @brief Get the number of opening turns the book covers */
+int OpeningBook::getDepth() const { return depth; }
+
+/** @brief Get the maximum number of recorded positions */
+std::size_t OpeningBook::getCapacity() const { return capacity; }
+
+/** @brief Get the number of recorded positions */
+std::size_t OpeningBook::size() const { return entries.size(); }
+
+/** @brief Get the number of successful lookups since construction */
+std::size_t OpeningBook::getHits() const { return hits; }
+
+/** @brief Get the number of failed lookups since construction */
+std::size_t OpeningBook::getMisses() const { return misses; }
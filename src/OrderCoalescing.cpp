@@ -0,0 +1,168 @@
+/**
+ * @file OrderCoalescing.cpp
+ * @brief Merging of same-target Deploys and same-pair Advances (see OrderCoalescing.h).
+ *
+ * @details
+ *  Each pass replays the validity checks of the orders in the sequence the engine will execute
+ *  them, without executing anything, and folds every order that would succeed into the first
+ *  successful order with the same key. Orders that would fail are never merged: they stay where
+ *  they are and still fail, because merging only moves armies earlier.
+ */
+
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include "../include/OrderCoalescing.h"
+#include "../include/Orders.h"
+#include "../include/Player.h"
+#include "../include/Map.h"
+
+namespace {
+    using TouchCounts = std::unordered_map<const Territory*, int>;
+
+    /**
+     * @brief Record the territories an order reads or changes, and the players of a Negotiate
+     * @return false if the order type is unknown (nothing can be assumed about it)
+     */
+    bool recordTouches(const Order* order, TouchCounts& touches, std::unordered_set<const Player*>& negotiating) {
+        if (const auto* deploy = dynamic_cast<const DeployOrder*>(order)) {
+            ++touches[deploy->getTarget()];
+        } else if (const auto* advance = dynamic_cast<const AdvanceOrder*>(order)) {
+            ++touches[advance->getSource()];
+            ++touches[advance->getTarget()];
+        } else if (const auto* airlift = dynamic_cast<const AirliftOrder*>(order)) {
+            ++touches[airlift->getSource()];
+            ++touches[airlift->getTarget()];
+        } else if (const auto* bomb = dynamic_cast<const BombOrder*>(order)) {
+            ++touches[bomb->getTarget()];
+        } else if (const auto* blockade = dynamic_cast<const BlockadeOrder*>(order)) {
+            ++touches[blockade->getTarget()];
+        } else if (const auto* negotiate = dynamic_cast<const NegotiateOrder*>(order)) {
+            negotiating.insert(negotiate->getIssuer());
+            negotiating.insert(negotiate->getOther());
+        } else {
+            return false;
+        }
+        return true;
+    }
+}
+
+namespace OrderCoalescing {
+
+    /**
+     * @brief Merge the Deploys of each player to the same territory
+     * @param players Players whose orders lists are coalesced
+     * @return Number of Deploy orders removed
+     *
+     * @details The deploy part executes a player's Deploys in list order against its pool. The
+     *          replay keeps the pool left after each successful Deploy (the checks of
+     *          DeployOrder::validate()); a successful Deploy is added to the first successful
+     *          Deploy to its territory. The merged orders deduct the same armies in total, which
+     *          fits the pool, so each of them still succeeds.
+     * @complexity O(orders) per player
+     */
+    int coalesceDeploys(const std::vector<Player*>& players) {
+        int removed = 0;
+        for (Player* player : players) {
+            OrdersList* list = player ? player->getOrdersList() : nullptr;
+            if (!list) continue;
+
+            const std::vector<Order*>& orders = list->getOrders();
+            std::unordered_map<const Territory*, DeployOrder*> firstDeploy;
+            std::vector<int> merged; // indices of the Deploys folded into an earlier one
+            int pool = player->getReinforcementPool();
+
+            for (std::size_t i = 0; i < orders.size(); ++i) {
+                auto* deploy = dynamic_cast<DeployOrder*>(orders[i]);
+                if (!deploy || deploy->getIssuer() != player) continue;
+
+                Territory* target = deploy->getTarget();
+                const int amount = deploy->getAmount();
+                if (!target || target->getOwner() != player || amount <= 0 || amount > pool) continue; // fails
+
+                pool -= amount;
+                auto first = firstDeploy.find(target);
+                if (first == firstDeploy.end()) {
+                    firstDeploy.emplace(target, deploy);
+                } else {
+                    first->second->setAmount(first->second->getAmount() + amount);
+                    merged.push_back(static_cast<int>(i));
+                }
+            }
+
+            // Back to front so the remaining indices stay valid
+            for (auto it = merged.rbegin(); it != merged.rend(); ++it) list->remove(*it);
+            removed += static_cast<int>(merged.size());
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Merge the Advances of each player along the same source-to-target pair
+     * @param players Players whose orders lists are coalesced
+     * @return Number of Advance orders marked coalesced
+     *
+     * @details A pair qualifies when its Advances are the only orders of the phase touching its
+     *          source or target and its issuer is in no Negotiate. Then nothing but these Advances
+     *          changes the two territories or the truce checked by AdvanceOrder::validate(), and
+     *          an Advance succeeds exactly when its armies are still on the source. The replay
+     *          keeps those armies; the first successful Advance takes the armies of the later
+     *          successful ones, which are marked coalesced.
+     * @complexity O(orders log orders)
+     */
+    int coalesceAdvances(const std::vector<Player*>& players) {
+        TouchCounts touches;
+        std::unordered_set<const Player*> negotiating;
+        for (Player* player : players) {
+            OrdersList* list = player ? player->getOrdersList() : nullptr;
+            if (!list) continue;
+            for (const Order* order : list->getOrders()) {
+                if (order->isCoalesced()) continue;
+                if (!recordTouches(order, touches, negotiating)) return 0; // unknown order: merge nothing
+            }
+        }
+
+        int coalesced = 0;
+        for (Player* player : players) {
+            OrdersList* list = player ? player->getOrdersList() : nullptr;
+            if (!list || negotiating.count(player)) continue;
+
+            // Advances of the player per (source, target), in execution order
+            std::map<std::tuple<const Territory*, const Territory*>, std::vector<AdvanceOrder*>> pairs;
+            for (Order* order : list->getOrders()) {
+                auto* advance = dynamic_cast<AdvanceOrder*>(order);
+                if (!advance || advance->isCoalesced() || advance->getIssuer() != player) continue;
+                if (!advance->getSource() || !advance->getTarget()) continue;
+                pairs[std::make_tuple(advance->getSource(), advance->getTarget())].push_back(advance);
+            }
+
+            for (auto& entry : pairs) {
+                const Territory* source = std::get<0>(entry.first);
+                const Territory* target = std::get<1>(entry.first);
+                std::vector<AdvanceOrder*>& advances = entry.second;
+                const int count = static_cast<int>(advances.size());
+                if (count < 2 || source == target) continue;
+                if (touches[source] != count || touches[target] != count) continue; // shared with other orders
+
+                AdvanceOrder* first = nullptr;
+                ArmyCount armies = source->getArmies();
+                for (AdvanceOrder* advance : advances) {
+                    const ArmyCount amount = advance->getAmount();
+                    if (amount <= 0 || amount > armies) continue; // fails
+                    if (!first) {
+                        // The armies are there: validate() now only depends on the pair itself
+                        if (!advance->validate()) break;
+                        first = advance;
+                    } else {
+                        first->setAmount(first->getAmount() + amount);
+                        advance->markCoalesced();
+                        ++coalesced;
+                    }
+                    armies -= amount;
+                }
+            }
+        }
+        return coalesced;
+    }
+}
@@ -2,11 +2,52 @@
 #include <iostream>
 #include <sstream>
 #include <random>
+#include <limits>
 #include "../include/Orders.h"
 #include "../include/Map.h"
 #include "../include/Player.h"
 #include "../include/Cards.h"
 #include "../include/PlayerStrategies.h"
+#include "../include/GameRules.h"
+#include "../include/BattleResolver.h"
+#include "../include/GameContext.h"
+
+namespace {
+    /**
+     * @brief Seed of the next battle of a player's game
+     * @details Orders of a player outside of an engine game (drivers) fall back to one engine per
+     *          thread instead of one per battle.
+     */
+    std::uint64_t nextBattleSeed(Player* player) {
+        if (GameContext* context = player ? player->getGameContext() : nullptr) return context->nextBattleSeed();
+        thread_local std::mt19937_64 seeds(std::random_device{}());
+        return seeds();
+    }
+}
+
+// ===== Validation cache =====
+
+/**
+ * @brief Whether the recorded result was computed with these versions
+ * @param versions Current versions of the entities the order reads, in a fixed order
+ */
+bool ValidationCache::isCurrent(std::initializer_list<std::uint64_t> versions) const {
+    return known && std::equal(versions.begin(), versions.end(), recorded);
+}
+
+/** @brief Result recorded by the last record() */
+bool ValidationCache::getResult() const { return result; }
+
+/**
+ * @brief Record a validation result with the versions it was computed from
+ * @return The recorded result, for `return validation_.record(...)`
+ */
+bool ValidationCache::record(std::initializer_list<std::uint64_t> versions, bool valid) {
+    known = versions.size() <= MAX_VERSIONS;
+    if (known) std::copy(versions.begin(), versions.end(), recorded);
+    result = valid;
+    return valid;
+}
 
 // ===== Base Order =====
 
@@ -33,6 +74,17 @@ const std::string& Order::effect() const { return effect_; }
  */
 const std::string& Order::getDescription() const { return description; }
 
+/**
+ * @brief Whether this order was merged into an earlier order of its list
+ * @return bool True if the engine must skip it instead of executing it
+ */
+bool Order::isCoalesced() const { return coalesced_; }
+
+/**
+ * @brief Marks this order as merged into an earlier one (its armies now belong to that order)
+ */
+void Order::markCoalesced() { coalesced_ = true; }
+
 /**
  * @brief Stream output operator for Order objects
  * @param os Output stream to write to
@@ -91,9 +143,11 @@ DeployOrder::DeployOrder(const DeployOrder& other)
  */
 bool DeployOrder::validate() const {
     if (!issuer_ || !target_ || amount_ <= 0) return false;
-    if (target_->getOwner() != issuer_) return false;
-    if (issuer_->getReinforcementPool() < amount_) return false;
-    return true;
+    const auto versions = {issuer_->getVersion(), target_->getVersion()};
+    if (validation_.isCurrent(versions)) return validation_.getResult();
+
+    bool valid = target_->getOwner() == issuer_ && issuer_->getReinforcementPool() >= amount_;
+    return validation_.record(versions, valid);
 }
 
 /**
@@ -128,6 +182,14 @@ void DeployOrder::execute() {
  */
 std::string DeployOrder::name() const { return "Deploy"; }
 
+Player* DeployOrder::getIssuer() const { return issuer_; }
+Territory* DeployOrder::getTarget() const { return target_; }
+int DeployOrder::getAmount() const { return amount_; }
+void DeployOrder::setAmount(int amount) {
+    amount_ = amount;
+    validation_ = ValidationCache(); // the recorded result was for the old amount
+}
+
 /**
  * @brief Creates a copy of this order
  * @return Order* Pointer to a new copy of this order
@@ -148,7 +210,7 @@ AdvanceOrder::AdvanceOrder() : Order("Advance") {}
  * @param target Territory armies are moving to
  * @param amount Number of armies to move
  */
-AdvanceOrder::AdvanceOrder(Player* issuer, Territory* source, Territory* target, int amount)
+AdvanceOrder::AdvanceOrder(Player* issuer, Territory* source, Territory* target, ArmyCount amount)
     : Order("Advance"), issuer_(issuer), source_(source), target_(target), amount_(amount) {}
 
 /**
@@ -166,13 +228,14 @@ AdvanceOrder::AdvanceOrder(const AdvanceOrder& other)
  */
 bool AdvanceOrder::validate() const {
     if (!issuer_ || !source_ || !target_ || amount_ <= 0) return false;
-    if (source_->getOwner() != issuer_) return false;
-    if (issuer_ && target_ && target_->getOwner()) {
-        if (issuer_->isNegotiatedWith(target_->getOwner())) return false;
-    }
-    if (!source_->isAdjacentTo(target_)) return false;
-    if (source_->getArmies() < amount_) return false;
-    return true;
+    const auto versions = {issuer_->getVersion(), source_->getVersion(), target_->getVersion()};
+    if (validation_.isCurrent(versions)) return validation_.getResult();
+
+    bool valid = source_->getOwner() == issuer_ &&
+                 !(target_->getOwner() && issuer_->isNegotiatedWith(target_->getOwner())) &&
+                 source_->isAdjacentTo(target_) &&
+                 source_->getArmies() >= amount_;
+    return validation_.record(versions, valid);
 }
 
 /**
@@ -195,8 +258,8 @@ void AdvanceOrder::execute() {
     }
 
     // Battle simulation
-    int attackerAmount = amount_;
-    int defenderAmount = target_->getArmies();
+    ArmyCount attackerAmount = amount_;
+    ArmyCount defenderAmount = target_->getArmies();
     
     // If neutral transform defender to aggressive
     Player* defender = target_->getOwner();
@@ -205,14 +268,7 @@ void AdvanceOrder::execute() {
         defender->setPlayerStrategy(new AggressivePlayerStrategy());
     }
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dis(0.0, 1.0);
-
-    while (attackerAmount > 0 && defenderAmount > 0) {
-        if (dis(gen) < 0.6) defenderAmount--; // attacker kills defender
-        if (dis(gen) < 0.7) attackerAmount--; // defender kills attacker
-    }
+    GameRules::resolveBattleSeeded<ActiveRules>(attackerAmount, defenderAmount, nextBattleSeed(issuer_));
 
     if (defenderAmount == 0) {
         // Conquer territory
@@ -257,6 +313,15 @@ void AdvanceOrder::execute() {
  */
 std::string AdvanceOrder::name() const { return "Advance"; }
 
+Player* AdvanceOrder::getIssuer() const { return issuer_; }
+Territory* AdvanceOrder::getSource() const { return source_; }
+Territory* AdvanceOrder::getTarget() const { return target_; }
+ArmyCount AdvanceOrder::getAmount() const { return amount_; }
+void AdvanceOrder::setAmount(ArmyCount amount) {
+    amount_ = amount;
+    validation_ = ValidationCache(); // the recorded result was for the old amount
+}
+
 /**
  * @brief Creates a copy of this order
  * @return Order* Pointer to a new copy of this order
@@ -293,19 +358,28 @@ BombOrder::BombOrder(const BombOrder& other)
  */
 bool BombOrder::validate() const {
     if (!issuer_ || !target_) return false;
-    if (issuer_ == target_ -> getOwner()) return false;
-    if (issuer_ && target_ && target_->getOwner()) {
-        if (issuer_->isNegotiatedWith(target_->getOwner())) return false;
-    }
-    bool isAnyOwnedTerritoryAdjacent = false;
-    for (Territory* t : issuer_->getOwnedTerritories()) {
-    if (t->isAdjacentTo(target_)) {
-        isAnyOwnedTerritoryAdjacent = true;
-        break;
+    // With symmetric adjacency a changed neighbour list of an owned territory changes the target
+    // too, so the two versions cover the result; otherwise it is recomputed every time
+    const bool symmetric = target_->hasSymmetricAdjacency();
+    const auto versions = {issuer_->getVersion(), target_->getVersion()};
+    if (symmetric && validation_.isCurrent(versions)) return validation_.getResult();
+
+    bool valid = false;
+    if (issuer_ == target_ -> getOwner()) {
+        valid = false;
+    } else if (target_->getOwner() && issuer_->isNegotiatedWith(target_->getOwner())) {
+        valid = false;
+    } else if (const TerritoryBitset* neighbours = symmetric ? target_->getNeighbourMask() : nullptr) {
+        valid = neighbours->intersects(issuer_->getOwnedMask()); // one word-parallel AND
+    } else {
+        for (Territory* t : issuer_->getOwnedTerritories()) {
+        if (t->isAdjacentTo(target_)) {
+            valid = true;
+            break;
+            }
         }
     }
-    if (!isAnyOwnedTerritoryAdjacent) return false;
-    return true;
+    return symmetric ? validation_.record(versions, valid) : valid;
 }
 
 /**
@@ -327,8 +401,8 @@ void BombOrder::execute() {
         defender->setPlayerStrategy(new AggressivePlayerStrategy());
     }
 
-    int before = target_->getArmies();
-    int removed = before / 2;
+    ArmyCount before = target_->getArmies();
+    ArmyCount removed = GameRules::bombCasualties<ActiveRules>(before);
     target_->removeArmies(removed);
 
     std::ostringstream ss;
@@ -346,6 +420,9 @@ void BombOrder::execute() {
  */
 std::string BombOrder::name() const { return "Bomb"; }
 
+Player* BombOrder::getIssuer() const { return issuer_; }
+Territory* BombOrder::getTarget() const { return target_; }
+
 /**
  * @brief Creates a copy of this order
  * @return Order* Pointer to a new copy of this order
@@ -378,10 +455,15 @@ BlockadeOrder::BlockadeOrder(const BlockadeOrder& other)
 
 /**
  * @brief Validates if the blockade order is valid
- * @return bool True if target is owned by issuer and exists
+ * @return bool True if target is owned by issuer and exists, and the issuer plays in a game (whose
+ *         Neutral player receives the territory)
  */
 bool BlockadeOrder::validate() const {
     if (!issuer_ || !target_) return false;
+    if (!issuer_->getGameContext()) return false; // no game, hence no Neutral player to hand the territory to
+    const auto versions = {issuer_->getVersion()};
+    if (validation_.isCurrent(versions)) return validation_.getResult();
+
     bool isOwnedByIssuer = false;
     for(Territory* t : issuer_ -> getOwnedTerritories()) {
         if(t == target_) {
@@ -389,8 +471,7 @@ bool BlockadeOrder::validate() const {
             break;
         }
     }
-    if (!isOwnedByIssuer) return false;
-    return true;
+    return validation_.record(versions, isOwnedByIssuer);
 }
 
 /**
@@ -403,11 +484,11 @@ void BlockadeOrder::execute() {
         return;
     }
 
-    // Double armies and transfer to Neutral
-    target_->addArmies(target_->getArmies());  // double
-    target_->setOwner(neutralPlayer);
-    neutralPlayer->addPlayerTerritory(target_);
-    issuer_->removePlayerTerritory(target_);
+    // Double armies and transfer to the Neutral player of the issuer's game
+    Player* neutral = issuer_->getGameContext()->getNeutralPlayer();
+    target_->setArmies(Armies::twice(target_->getArmies()));  // double, saturating at Armies::MAX
+    issuer_->removePlayerTerritory(target_); // clears the owner: before the Neutral player takes it
+    neutral->addPlayerTerritory(target_);
 
     std::ostringstream ss;
     ss << "Blockade on " << target_->getName()
@@ -425,6 +506,9 @@ void BlockadeOrder::execute() {
  */
 std::string BlockadeOrder::name() const { return "Blockade"; }
 
+Player* BlockadeOrder::getIssuer() const { return issuer_; }
+Territory* BlockadeOrder::getTarget() const { return target_; }
+
 /**
  * @brief Creates a copy of this order
  * @return Order* Pointer to a new copy of this order
@@ -445,7 +529,7 @@ AirliftOrder::AirliftOrder() : Order("Airlift") {}
  * @param target Territory to airlift armies to
  * @param amount Number of armies to airlift
  */
-AirliftOrder::AirliftOrder(Player* issuer, Territory* source, Territory* target, int amount)
+AirliftOrder::AirliftOrder(Player* issuer, Territory* source, Territory* target, ArmyCount amount)
     : Order("Airlift"), issuer_(issuer), source_(source), target_(target), amount_(amount) {}
 
 /**
@@ -463,10 +547,12 @@ AirliftOrder::AirliftOrder(const AirliftOrder& other)
  */
 bool AirliftOrder::validate() const {
     if (!issuer_ || !source_ || !target_ || amount_ <= 0) return false;
-    if (issuer_ != source_ -> getOwner()) return false;
-    if (issuer_ != target_ -> getOwner()) return false;
-    if (amount_ > source_ -> getArmies()) return false;
-    return true;
+    const auto versions = {source_->getVersion(), target_->getVersion()};
+    if (validation_.isCurrent(versions)) return validation_.getResult();
+
+    bool valid = issuer_ == source_ -> getOwner() && issuer_ == target_ -> getOwner() &&
+                 amount_ <= source_ -> getArmies();
+    return validation_.record(versions, valid);
 }
 
 /**
@@ -497,6 +583,11 @@ void AirliftOrder::execute() {
  */
 std::string AirliftOrder::name() const { return "Airlift"; }
 
+Player* AirliftOrder::getIssuer() const { return issuer_; }
+Territory* AirliftOrder::getSource() const { return source_; }
+Territory* AirliftOrder::getTarget() const { return target_; }
+ArmyCount AirliftOrder::getAmount() const { return amount_; }
+
 /**
  * @brief Creates a copy of this order
  * @return Order* Pointer to a new copy of this order
@@ -566,6 +657,9 @@ void NegotiateOrder::execute() {
  */
 std::string NegotiateOrder::name() const { return "Negotiate"; }
 
+Player* NegotiateOrder::getIssuer() const { return issuer_; }
+Player* NegotiateOrder::getOther() const { return other_; }
+
 /**
  * @brief Creates a copy of this order
  * @return Order* Pointer to a new copy of this order
@@ -586,7 +680,8 @@ OrdersList::~OrdersList() {
  * @brief Copy constructor performing deep copy of all orders
  * @param other OrdersList to copy from
  */
-OrdersList::OrdersList(const OrdersList& other) {
+OrdersList::OrdersList(const OrdersList& other)
+    : budget(other.budget), addedThisTurn(other.addedThisTurn), dropped(other.dropped) {
     orders.reserve(other.orders.size());
     for (Order* order : other.orders) {
         orders.push_back(order ? order->clone() : nullptr);
@@ -607,6 +702,9 @@ OrdersList& OrdersList::operator=(const OrdersList& other) {
     }
     for (Order* order : orders) delete order;
     orders.swap(tmp);
+    budget = other.budget;
+    addedThisTurn = other.addedThisTurn;
+    dropped = other.dropped;
     return *this;
 }
 
@@ -615,7 +713,7 @@ OrdersList& OrdersList::operator=(const OrdersList& other) {
  * @param other OrdersList to move from
  */
 OrdersList::OrdersList(OrdersList&& other) noexcept
-    : orders(std::move(other.orders)) {
+    : orders(std::move(other.orders)), budget(other.budget), addedThisTurn(other.addedThisTurn), dropped(other.dropped) {
     other.orders.clear();
 }
 
@@ -629,18 +727,63 @@ OrdersList& OrdersList::operator=(OrdersList&& other) noexcept {
         for (Order* order : orders) delete order;
         orders = std::move(other.orders);
         other.orders.clear();
+        budget = other.budget;
+        addedThisTurn = other.addedThisTurn;
+        dropped = other.dropped;
     }
     return *this;
 }
 
 /**
  * @brief Adds an order to the end of the list
- * @param order Order to add to the list
- */
-void OrdersList::add(Order* order) {
-    if (!order) return;
+ * @param order Order to add to the list (owned by the list from now on)
+ * @return false if the turn budget is used up: the order is deleted and counted as dropped
+ */
+bool OrdersList::add(Order* order) {
+    if (!order) return false;
+    if (isFull()) {
+        delete order;
+        ++dropped;
+        return false;
+    }
     orders.push_back(order);
+    ++addedThisTurn;
     notify();  // Notify observers that an order was added
+    return true;
+}
+
+/**
+ * @brief Limit the orders accepted per turn
+ * @param maxOrdersPerTurn Budget, or UNLIMITED_BUDGET
+ */
+void OrdersList::setBudget(std::size_t maxOrdersPerTurn) {
+    budget = maxOrdersPerTurn;
+}
+
+/** @brief Orders accepted per turn (UNLIMITED_BUDGET if none) */
+std::size_t OrdersList::getBudget() const {
+    return budget;
+}
+
+/** @brief Start a new turn: the whole budget is available again */
+void OrdersList::beginTurn() {
+    addedThisTurn = 0;
+}
+
+/** @brief Orders add() still accepts this turn */
+std::size_t OrdersList::remaining() const {
+    if (budget == UNLIMITED_BUDGET) return std::numeric_limits<std::size_t>::max();
+    return addedThisTurn < budget ? budget - addedThisTurn : 0;
+}
+
+/** @brief Whether add() refuses orders until the next turn */
+bool OrdersList::isFull() const {
+    return remaining() == 0;
+}
+
+/** @brief Orders refused over the budget since the list was created */
+std::size_t OrdersList::getDropped() const {
+    return dropped;
 }
 
 /**
@@ -0,0 +1,258 @@
+/**
+ * @file PerfCounters.cpp
+ * @brief perf_event_open readings with a getrusage fallback (see PerfCounters.h).
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include "../include/PerfCounters.h"
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#if defined(__linux__)
+    /**
+     * @brief Open a counter of the calling thread (user space only, so it works at paranoid level 2)
+     * @return The file descriptor, or -1 if the event is unavailable
+     */
+    int openEvent(std::uint32_t type, std::uint64_t config) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        return fd < 0 ? -1 : static_cast<int>(fd);
+    }
+
+    /** @brief Count of an event, scaled up when the kernel multiplexed it with other events */
+    std::uint64_t readEvent(int fd) {
+        std::uint64_t values[3] = {0, 0, 0}; // value, time enabled, time running
+        if (::read(fd, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values))) return 0;
+        if (values[2] == 0 || values[2] >= values[1]) return values[0];
+        return static_cast<std::uint64_t>(static_cast<double>(values[0]) * values[1] / values[2]);
+    }
+#endif
+
+    /** @brief Print a count with thousands grouped by spaces (e.g. "12 345 678") */
+    std::ostream& printCount(std::ostream& os, std::uint64_t count) {
+        if (count < 1000) return os << count;
+        printCount(os, count / 1000);
+        return os << ' ' << std::setw(3) << std::setfill('0') << count % 1000 << std::setfill(' ');
+    }
+}
+
+PerfSample& PerfSample::operator+=(const PerfSample& other) {
+    calls += other.calls;
+    wallMs += other.wallMs;
+    cpuMs += other.cpuMs;
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cacheMisses += other.cacheMisses;
+    branchMisses += other.branchMisses;
+    pageFaults += other.pageFaults;
+    contextSwitches += other.contextSwitches;
+    return *this;
+}
+
+/** @brief Counters between two readings of the same thread (one call) */
+PerfSample operator-(const PerfSample& later, const PerfSample& earlier) {
+    PerfSample delta;
+    delta.calls = 1;
+    delta.wallMs = later.wallMs - earlier.wallMs;
+    delta.cpuMs = later.cpuMs - earlier.cpuMs;
+    delta.cycles = later.cycles - earlier.cycles;
+    delta.instructions = later.instructions - earlier.instructions;
+    delta.cacheMisses = later.cacheMisses - earlier.cacheMisses;
+    delta.branchMisses = later.branchMisses - earlier.branchMisses;
+    delta.pageFaults = later.pageFaults - earlier.pageFaults;
+    delta.contextSwitches = later.contextSwitches - earlier.contextSwitches;
+    return delta;
+}
+
+/** @brief Counters of the calling thread, opened on its first call */
+PerfCounters& PerfCounters::forThisThread() {
+    thread_local PerfCounters counters;
+    return counters;
+}
+
+/**
+ * @brief Open every event that is available to this thread
+ * @details Hardware events need a PMU visible to the process; software events only need
+ *          perf_event_open. The source is the best tier that fully opened.
+ */
+PerfCounters::PerfCounters() : source(PerfSource::Rusage) {
+    fds.fill(-1);
+#if defined(__linux__)
+    fds[Cycles] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds[Instructions] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds[CacheMisses] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    fds[BranchMisses] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    fds[TaskClock] = openEvent(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK);
+    fds[PageFaults] = openEvent(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+    fds[ContextSwitches] = openEvent(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES);
+
+    const bool software = fds[TaskClock] >= 0 && fds[PageFaults] >= 0 && fds[ContextSwitches] >= 0;
+    const bool hardware = fds[Cycles] >= 0 && fds[Instructions] >= 0 && fds[CacheMisses] >= 0 && fds[BranchMisses] >= 0;
+    if (software) source = hardware ? PerfSource::Hardware : PerfSource::Software;
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#if !defined(_WIN32)
+    for (int fd : fds) {
+        if (fd >= 0) ::close(fd);
+    }
+#endif
+}
+
+/**
+ * @brief Cumulative counters of the calling thread
+ * @details Values without an open event come from getrusage (per thread on Linux); hardware
+ *          values without an event stay 0.
+ */
+PerfSample PerfCounters::read() const {
+    PerfSample sample;
+    sample.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+#if !defined(_WIN32)
+    const bool needUsage = fds[TaskClock] < 0 || fds[PageFaults] < 0 || fds[ContextSwitches] < 0;
+    if (needUsage) {
+        rusage usage;
+#if defined(RUSAGE_THREAD)
+        const int who = RUSAGE_THREAD;
+#else
+        const int who = RUSAGE_SELF;
+#endif
+        if (getrusage(who, &usage) == 0) {
+            sample.cpuMs = (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 +
+                           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+            sample.pageFaults = static_cast<std::uint64_t>(usage.ru_minflt + usage.ru_majflt);
+            sample.contextSwitches = static_cast<std::uint64_t>(usage.ru_nvcsw + usage.ru_nivcsw);
+        }
+    }
+#endif
+
+#if defined(__linux__)
+    if (fds[Cycles] >= 0) sample.cycles = readEvent(fds[Cycles]);
+    if (fds[Instructions] >= 0) sample.instructions = readEvent(fds[Instructions]);
+    if (fds[CacheMisses] >= 0) sample.cacheMisses = readEvent(fds[CacheMisses]);
+    if (fds[BranchMisses] >= 0) sample.branchMisses = readEvent(fds[BranchMisses]);
+    if (fds[TaskClock] >= 0) sample.cpuMs = readEvent(fds[TaskClock]) / 1e6; // nanoseconds
+    if (fds[PageFaults] >= 0) sample.pageFaults = readEvent(fds[PageFaults]);
+    if (fds[ContextSwitches] >= 0) sample.contextSwitches = readEvent(fds[ContextSwitches]);
+#endif
+    return sample;
+}
+
+PerfSource PerfCounters::getSource() const { return source; }
+
+std::ostream& operator<<(std::ostream& os, const PerfCounters& counters) {
+    return os << "PerfCounters(" << perfSourceToString(counters.source) << ")";
+}
+
+/** @brief Add one measured call to a phase; the profile keeps the weakest source it was given */
+void PhaseProfile::add(PerfPhase phase, const PerfSample& delta, PerfSource from) {
+    phases[static_cast<std::size_t>(phase)] += delta;
+    if (from > source) source = from;
+}
+
+const PerfSample& PhaseProfile::get(PerfPhase phase) const {
+    return phases[static_cast<std::size_t>(phase)];
+}
+
+PerfSource PhaseProfile::getSource() const { return source; }
+
+/** @brief Whether no call was measured */
+bool PhaseProfile::empty() const {
+    for (const PerfSample& sample : phases) {
+        if (sample.calls > 0) return false;
+    }
+    return true;
+}
+
+void PhaseProfile::clear() {
+    phases.fill(PerfSample());
+    source = PerfSource::Hardware;
+}
+
+/** @brief Add the totals of another profile (e.g. a game into its tournament) */
+PhaseProfile& PhaseProfile::operator+=(const PhaseProfile& other) {
+    if (other.empty()) return *this;
+    for (std::size_t p = 0; p < PERF_PHASE_COUNT; ++p) phases[p] += other.phases[p];
+    if (other.source > source) source = other.source;
+    return *this;
+}
+
+/**
+ * @brief Print the source, then one line per measured phase
+ * @details Hardware columns only appear when every sample came from hardware events.
+ */
+std::ostream& operator<<(std::ostream& os, const PhaseProfile& profile) {
+    if (profile.empty()) return os << "  (no phase measured)\n";
+    const bool hardware = profile.source == PerfSource::Hardware;
+    os << "  counters: " << perfSourceToString(profile.source) << "\n";
+    for (std::size_t p = 0; p < PERF_PHASE_COUNT; ++p) {
+        const PerfSample& s = profile.phases[p];
+        if (s.calls == 0) continue;
+        os << "  " << std::left << std::setw(15) << perfPhaseToString(static_cast<PerfPhase>(p)) << std::right
+           << " calls " << s.calls << ", wall " << s.wallMs << " ms, cpu " << s.cpuMs << " ms";
+        if (hardware) {
+            os << ", cycles ";
+            printCount(os, s.cycles) << ", instructions ";
+            printCount(os, s.instructions) << " (IPC "
+               << (s.cycles ? static_cast<double>(s.instructions) / s.cycles : 0.0) << "), cache misses ";
+            printCount(os, s.cacheMisses) << ", branch misses ";
+            printCount(os, s.branchMisses);
+        }
+        os << ", page faults ";
+        printCount(os, s.pageFaults) << ", context switches ";
+        printCount(os, s.contextSwitches) << "\n";
+    }
+    return os;
+}
+
+/** @brief Start measuring (reads the counters of the calling thread) */
+PerfScope::PerfScope(PhaseProfile* profile, PerfPhase phase) : profile(profile), phase(phase) {
+    if (profile) start = PerfCounters::forThisThread().read();
+}
+
+/** @brief Add the counters since the start to the profile */
+PerfScope::~PerfScope() {
+    if (!profile) return;
+    const PerfCounters& counters = PerfCounters::forThisThread();
+    profile->add(phase, counters.read() - start, counters.getSource());
+}
+
+const char* perfPhaseToString(PerfPhase phase) {
+    switch (phase) {
+        case PerfPhase::Reinforcement: return "reinforcement";
+        case PerfPhase::IssueOrders:   return "issue orders";
+        case PerfPhase::ExecuteOrders: return "execute orders";
+        case PerfPhase::LoadMap:       return "load map";
+        case PerfPhase::ValidateMap:   return "validate map";
+        case PerfPhase::NeighbourWalk: return "neighbour walk";
+    }
+    return "unknown";
+}
+
+const char* perfSourceToString(PerfSource source) {
+    switch (source) {
+        case PerfSource::Hardware: return "hardware and software perf events";
+        case PerfSource::Software: return "software perf events (no hardware events available)";
+        case PerfSource::Rusage:   return "getrusage (no perf events available)";
+    }
+    return "unknown";
+}
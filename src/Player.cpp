@@ -19,7 +19,9 @@ Player::Player()
       cardAwardedThisTurn(false),
       reinforcementPool(0),
       orders_(new OrdersList()), 
-      playerStrategy(nullptr)
+      playerStrategy(nullptr),
+      version(0),
+      context(nullptr)
       {}
 // Constructor with strategy parameter for Player.
 Player::Player(PlayerStrategy* strategy)
@@ -30,7 +32,9 @@ Player::Player(PlayerStrategy* strategy)
         cardAwardedThisTurn(false),
         reinforcementPool(0),
         orders_(new OrdersList()),
-        playerStrategy(strategy)
+        playerStrategy(strategy),
+        version(0),
+        context(nullptr)
 {
     if (playerStrategy) {
         playerStrategy->setPlayer(this);
@@ -42,11 +46,14 @@ Player::Player(const Player& copyPlayer)
     : playerName(copyPlayer.playerName),
       playerHand(new Hand(*copyPlayer.playerHand)),
       ownedTerritories(copyPlayer.ownedTerritories),
+      ownedMask(copyPlayer.ownedMask),
       negotiatedPlayers(copyPlayer.negotiatedPlayers),
       cardAwardedThisTurn(copyPlayer.cardAwardedThisTurn),
       reinforcementPool(copyPlayer.reinforcementPool),
       orders_(new OrdersList(*copyPlayer.orders_)),
-      playerStrategy(nullptr)
+      playerStrategy(nullptr),
+      version(0),
+      context(copyPlayer.context)
 {
     if (copyPlayer.playerStrategy) {
         playerStrategy = copyPlayer.playerStrategy->clone();
@@ -64,7 +71,9 @@ Player::Player(std::string name)
       cardAwardedThisTurn(false),
       reinforcementPool(0),
       orders_(new OrdersList()),
-      playerStrategy(nullptr)
+      playerStrategy(nullptr),
+      version(0),
+      context(nullptr)
 {}
 
 
@@ -83,11 +92,14 @@ Player& Player::operator=(const Player& copyPlayer) {
         playerHand = new Hand(*copyPlayer.playerHand);
         
         ownedTerritories = copyPlayer.ownedTerritories;
+        ownedMask = copyPlayer.ownedMask;
         // deep copy into existing list
         *orders_ = *copyPlayer.orders_;
         cardAwardedThisTurn = copyPlayer.cardAwardedThisTurn;
         negotiatedPlayers = copyPlayer.negotiatedPlayers;  
         reinforcementPool = copyPlayer.reinforcementPool;
+        context = copyPlayer.context;
+        ++version;
 
         delete playerStrategy;
         playerStrategy = nullptr;
@@ -111,9 +123,6 @@ Player::~Player() {
     playerHand = nullptr;
     orders_ = nullptr;
 }
-// Neutral player instance
-Player* neutralPlayer = nullptr;
-
 // Getter for Player's Name.
 std::string Player::getPlayerName() const {
     return playerName;
@@ -135,6 +144,13 @@ PlayerStrategy* Player::getPlayerStrategy() const {
     return playerStrategy;
 }
 
+// Detaches the strategy from the Player; the caller becomes its owner.
+PlayerStrategy* Player::releasePlayerStrategy() {
+    PlayerStrategy* strategy = playerStrategy;
+    playerStrategy = nullptr;
+    return strategy;
+}
+
 // Card Awarded This Turn Setter 
 void Player::setCardAwardedThisTurn(bool awarded) {
     cardAwardedThisTurn = awarded;
@@ -151,6 +167,8 @@ bool Player::getCardAwardedThisTurn() const {
 // Add to a Player's owned territories.
 void Player::addPlayerTerritory(Territory* territory) {
     ownedTerritories.push_back(territory);
+    ownedMask.set(territory->getId());
+    ++version;
     territory->setOwner(this);
 }
 
@@ -159,6 +177,10 @@ void Player::removePlayerTerritory(Territory* territory) {
     std::vector<Territory*>::iterator it = std::find(ownedTerritories.begin(), ownedTerritories.end(), territory);
     if (it != ownedTerritories.end()) {
         ownedTerritories.erase(it);
+        if (std::find(ownedTerritories.begin(), ownedTerritories.end(), territory) == ownedTerritories.end()) {
+            ownedMask.reset(territory->getId()); // unless it was listed twice
+        }
+        ++version;
         territory->setOwner(nullptr);
     }
 }
@@ -167,20 +189,54 @@ void Player::removePlayerTerritory(Territory* territory) {
 std::vector<Territory*> Player::getOwnedTerritories() const {
     return ownedTerritories;
 }
+
+// Getter for the ids of the owned territories, as a bitset.
+const TerritoryBitset& Player::getOwnedMask() const {
+    return ownedMask;
+}
+
+/**
+ * @brief Whether the player owns every territory of a continent
+ * @complexity O(territories / 64) word tests when the continent has a mask, O(continent size) otherwise
+ */
+bool Player::ownsContinent(const Continent& continent) const {
+    if (continent.getTerritories().empty()) return false;
+    if (const TerritoryBitset* members = continent.getTerritoryMask()) return members->isSubsetOf(ownedMask);
+    for (const Territory* t : continent.getTerritories()) {
+        if (!t || !ownedMask.test(t->getId())) return false;
+    }
+    return true;
+}
 // Negotiation Management
 void Player::addNegotiatedPlayer(Player* p) { 
     negotiatedPlayers.insert(p); 
+    ++version;
 }
 
 void Player::clearNegotiatedPlayers() {
     negotiatedPlayers.clear();
+    ++version;
  }
 
 bool Player::isNegotiatedWith(Player* p) const {
     return negotiatedPlayers.find(p) != negotiatedPlayers.end();
 }
 
-void Player::subtractFromReinforcementPool(int amt) { reinforcementPool -= amt; }
+void Player::subtractFromReinforcementPool(int amt) {
+    reinforcementPool -= amt;
+    ++version;
+}
+
+/**
+ * @brief Version of the state orders read from this player (territory list, truces, pool)
+ * @return Counter bumped by every change of that state; used by the order validation cache
+ */
+std::uint64_t Player::getVersion() const { return version; }
+
+// Setter and getter for the game the player takes part in.
+void Player::setGameContext(GameContext* gameContext) { context = gameContext; }
+
+GameContext* Player::getGameContext() const { return context; }
 
 //Attack / Defend Lists
 
@@ -206,10 +262,11 @@ std::vector<Territory*> Player::toAttack() {
      * Use only to as per the spec 
      */
     std::vector<Territory*> attackList;
+    TerritoryBitset listed; // ids already in attackList
     for (Territory* mine : ownedTerritories) {
         for (Territory* adj : mine->getAdjacents()) {
-            if (adj->getOwner() != this &&
-                std::find(attackList.begin(), attackList.end(), adj) == attackList.end()) {
+            if (adj->getOwner() != this && !listed.test(adj->getId())) {
+                listed.set(adj->getId());
                 attackList.push_back(adj);
             }
         }
@@ -234,8 +291,23 @@ bool Player::issueOrder(Order* orderIssued) {
      * Use only to as per the spec 
      */
         
-    orders_->add(orderIssued);
-    return true;
+    return orders_->add(orderIssued);
+}
+
+
+/**
+ * @brief Anytime variant of issueOrder(): the strategy decides within the given budget
+ * @param budget Time/iteration budget for this decision
+ * @return true if an order was created during this call
+ */
+bool Player::issueOrder(DecisionBudget& budget) {
+    if (ownedTerritories.empty()) {
+        return false;
+    }
+    if (playerStrategy) {
+        return playerStrategy->issueOrderWithin(budget);
+    }
+    return issueOrder();
 }
 
 
@@ -296,13 +368,16 @@ bool Player::issueOrder() {
 
         // Simple heuristic: dump the whole pool this pass.
         const int deployAmount = reinforcementPool;
-        reinforcementPool -= deployAmount;
         if (deployAmount <= 0) {
             return false;
         }
 
         Order* deployOrder = new DeployOrder(this, target, deployAmount);
-        orders_->add(deployOrder);
+        if (!orders_->add(deployOrder)) {
+            return false; // over the turn budget: the armies stay in the pool
+        }
+        reinforcementPool -= deployAmount;
+        ++version;
 
         std::cout << "Player " << playerName << " issues Deploy("
                   << deployAmount << " on " << target->getName() << ")\n";
@@ -319,11 +394,11 @@ bool Player::issueOrder() {
         for (Territory* adj : src->getAdjacents()) {
             if (!adj) continue;
             if (adj->getOwner() != this) {
-                int advanceAmount = src->getArmies() / 2; // simple heuristic
+                ArmyCount advanceAmount = src->getArmies() / 2; // simple heuristic
                 if (advanceAmount <= 0) continue;
 
                 Order* advanceOrder = new AdvanceOrder(this, src, adj, advanceAmount);
-                orders_->add(advanceOrder);
+                if (!orders_->add(advanceOrder)) return false;
 
                 std::cout << "Player " << playerName << " issues Advance("
                           << advanceAmount << " from " << src->getName()
@@ -341,11 +416,11 @@ bool Player::issueOrder() {
 
         for (Territory* adj : src->getAdjacents()) {
             if (adj && adj->getOwner() == this) {
-                int advanceAmount = src->getArmies() / 2;
+                ArmyCount advanceAmount = src->getArmies() / 2;
                 if (advanceAmount <= 0) continue;
 
                 Order* advanceOrder = new AdvanceOrder(this, src, adj, advanceAmount);
-                orders_->add(advanceOrder);
+                if (!orders_->add(advanceOrder)) return false;
 
                 std::cout << "Player " << playerName << " issues Advance("
                           << advanceAmount << " from " << src->getName()
@@ -409,6 +484,7 @@ int Player::getReinforcementPool() const {
 */
 void Player::setReinforcementPool(int newPool) {
     reinforcementPool = newPool;
+    ++version;
 }
 
 /**
@@ -418,6 +494,7 @@ void Player::setReinforcementPool(int newPool) {
 void Player::addReinforcements(int amount) {
     if (amount > 0){
         reinforcementPool += amount;
+        ++version;
     }
 }
 
@@ -429,6 +506,14 @@ bool Player::hasTerritories() const {
     return !ownedTerritories.empty();
 }
 
+/**
+ * @brief Number of territories the player owns
+ * @return std::size_t Size of the owned-territory list
+ */
+std::size_t Player::getTerritoryCount() const {
+    return ownedTerritories.size();
+}
+
 
 // Stream overloading for Player.
 std::ostream& operator<<(std::ostream& os, const Player& player) {
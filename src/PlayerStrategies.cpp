@@ -14,6 +14,14 @@ PlayerStrategy::PlayerStrategy() : player_(nullptr) {}
 PlayerStrategy::PlayerStrategy(Player* player) : player_(player) {}
 PlayerStrategy::~PlayerStrategy() = default;
 
+const char* PlayerStrategy::openingBookId() const { return nullptr; }
+
+/** Pooled strategies start each game like a new round, with no player attached */
+void PlayerStrategy::resetForNewGame() {
+    resetForNewRound();
+    player_ = nullptr;
+}
+
 PlayerStrategy::PlayerStrategy(const PlayerStrategy& other) {
     // Do not copy the player pointer; the owning Player will set this when cloning
     player_ = nullptr;
@@ -35,6 +43,44 @@ std::ostream& operator<<(std::ostream& os, const PlayerStrategy& ps) {
 Player* PlayerStrategy::getPlayer() const { return player_; }
 void PlayerStrategy::setPlayer(Player* player) { player_ = player; }
 
+/** Strategies whose decision takes constant time decide as usual and ignore the budget */
+bool PlayerStrategy::issueOrderWithin(DecisionBudget& budget) {
+    (void)budget;
+    return issueOrder();
+}
+
+bool PlayerStrategy::isInteractive() const { return false; }
+
+// ========== DecisionBudget ==========
+DecisionBudget::DecisionBudget()
+    : hasDeadline_(false), deadline_(), maxIterations_(UNLIMITED_ITERATIONS), iterations_(0) {}
+
+DecisionBudget::DecisionBudget(Clock::duration timeLimit, long maxIterations)
+    : hasDeadline_(true), deadline_(Clock::now() + timeLimit), maxIterations_(maxIterations), iterations_(0) {}
+
+/** Count units of work. Returns false once the deadline passed or the iterations are used up */
+bool DecisionBudget::step(long units) {
+    iterations_ += units;
+    return !exhausted();
+}
+
+bool DecisionBudget::exhausted() const {
+    if (maxIterations_ != UNLIMITED_ITERATIONS && iterations_ >= maxIterations_) return true;
+    return hasDeadline_ && Clock::now() >= deadline_;
+}
+
+bool DecisionBudget::isUnlimited() const {
+    return !hasDeadline_ && maxIterations_ == UNLIMITED_ITERATIONS;
+}
+
+long DecisionBudget::getIterations() const { return iterations_; }
+
+std::ostream& operator<<(std::ostream& os, const DecisionBudget& budget) {
+    os << "DecisionBudget [" << (budget.isUnlimited() ? "unlimited" : "limited")
+       << ", iterations: " << budget.iterations_ << "]";
+    return os;
+}
+
 
 /** Currently all functions are placeholders.
  * @TODO:  Actual implementation of all functions per the spec */
@@ -45,14 +91,14 @@ AggressivePlayerStrategy::AggressivePlayerStrategy() : PlayerStrategy() {}
 AggressivePlayerStrategy::~AggressivePlayerStrategy() = default;
 
 AggressivePlayerStrategy::AggressivePlayerStrategy(const AggressivePlayerStrategy& other)
-    : PlayerStrategy(other) {
-    // Copy any AggressivePlayerStrategy-specific members here if added in future
+    : PlayerStrategy(other), plan_() {
+    // The plan belongs to the player being followed; the copy builds its own on first use
 }
 
 AggressivePlayerStrategy& AggressivePlayerStrategy::operator=(const AggressivePlayerStrategy& other) {
     if (this != &other) {
         PlayerStrategy::operator=(other);
-        // Copy any AggressivePlayerStrategy-specific members here if added in future
+        plan_.clear(); // player_ was reset: the plan is rebuilt on first use
     }
     return *this;
 }
@@ -61,20 +107,32 @@ PlayerStrategy* AggressivePlayerStrategy::clone() const {
     return new AggressivePlayerStrategy(*this);
 }
 
+const char* AggressivePlayerStrategy::getStrategyName() const { return "Aggressive"; }
+
 std::ostream& operator<<(std::ostream& os, const AggressivePlayerStrategy& ps) {
     (void)ps;
     os << "AggressivePlayerStrategy";
     return os;
 }
 
+/** Aggressive decisions depend only on the board and the reinforcement pool, so its
+ openings can be replayed from the opening book */
+const char* AggressivePlayerStrategy::openingBookId() const { return "Aggressive"; }
+
+/** A pooled strategy starts the next game without the previous game's plan */
+void AggressivePlayerStrategy::resetForNewGame() {
+    plan_.attach(nullptr);
+    PlayerStrategy::resetForNewGame();
+}
+
+const StrategyPlan& AggressivePlayerStrategy::getPlan() const { return plan_; }
+
 /** Return territories sorted by army count (descending) - strongest first
- Strategy: Focus on strongest territory for defense */
+ Strategy: Focus on strongest territory for defense.
+ The order comes from the persistent plan, which only reorders territories whose armies changed */
 std::vector<Territory*> AggressivePlayerStrategy::toDefend() {
-    std::vector<Territory*> defendList = player_->getOwnedTerritories();
-    std::sort(defendList.begin(), defendList.end(), [](Territory* a, Territory* b) {
-        return a->getArmies() > b->getArmies();
-    });
-    return defendList;
+    plan_.attach(player_);
+    return plan_.strongestFirst();
 }
 
 /** Returns all adjacent enemy territories.
@@ -114,13 +172,13 @@ bool AggressivePlayerStrategy::deployToStrongest() {
         return false;
     }
     
-    std::vector<Territory*> defendList = toDefend();
-    if (defendList.empty()) {
+    plan_.attach(player_);
+    Territory* strongest = plan_.strongest();
+    if (!strongest) {
         return false;
     }
-    Territory* strongest = defendList.front();
     DeployOrder* deployOrder = new DeployOrder(player_, strongest, numReinforcements);
-    player_->getOrdersList()->add(deployOrder);
+    if (!player_->getOrdersList()->add(deployOrder)) return false;
     player_->subtractFromReinforcementPool(numReinforcements);
     
     std::cout << "[AggressivePlayerStrategy] issueOrder() - DEPLOY logic executed.\n";
@@ -136,106 +194,93 @@ bool AggressivePlayerStrategy::deployToStrongest() {
  * requirement to "always advance to enemy territories until it cannot do so anymore".
  * 
  * Strategy:
- * - Iterates through owned territories sorted by army count (strongest first)
+ * - Iterates through owned territories sorted by army count (strongest first), straight from the plan
  * - For each territory with at least 2 armies (must leave 1 behind)
  * - Finds the weakest adjacent enemy territory
  * - Creates an AdvanceOrder to attack with all available armies (armies - 1)
  * - Returns immediately after issuing one attack order
  * 
+ * The same scan remembers the first territory that could consolidate into the strongest one
+ * (the move consolidateToStrongest() issues when there is nothing to attack), so the caller
+ * still has the best order found so far when the budget runs out before an attack is found.
+ * 
+ * @param budget One step per source territory examined
+ * @param consolidationSource Set to the first examined territory adjacent to the strongest one
+ *        with armies to move, nullptr if none
  * @return true if an attack order was issued
- * @return false if no owned territories have adjacent enemies or sufficient armies to attack
+ * @return false if no examined territory has adjacent enemies and sufficient armies to attack
  * 
- * @pre player_ must own at least one territory
+ * @pre player_ must own at least one territory and the plan must be attached
  * @post An AdvanceOrder to an enemy territory is added to the player's orders list if successful
  */
-bool AggressivePlayerStrategy::attackAdjacentEnemies() {
-    std::vector<Territory*> defendList = toDefend(); // Sorted strongest first
-    
-    if (defendList.empty()) {
+bool AggressivePlayerStrategy::attackAdjacentEnemies(DecisionBudget& budget, Territory*& consolidationSource) {
+    consolidationSource = nullptr;
+    Territory* strongest = plan_.strongest();
+    if (!strongest) {
         return false;
     }
     
     // Try to attack from any owned territory (prioritizing strongest)
     // "always advances to enemy territories until it cannot do so anymore"
-    for (Territory* source : defendList) {
-        if (source->getArmies() <= 1) {
-            continue; // Need at least 2 armies to advance (must leave 1 behind)
-        }
-        
-        // Find weakest adjacent enemy from this territory
-        Territory* weakestEnemy = nullptr;
-        int minEnemyArmies = INT_MAX;
-        
-        for (Territory* adj : source->getAdjacents()) {
-            if (adj->getOwner() != player_ && adj->getOwner() != nullptr) {
-                if (adj->getArmies() < minEnemyArmies) {
-                    minEnemyArmies = adj->getArmies();
-                    weakestEnemy = adj;
-                }
+    Territory* attacker = nullptr;
+    Territory* weakestEnemy = nullptr;
+    plan_.forEachStrongestFirst([&](Territory* source) {
+        if (source->getArmies() > 1) { // Need at least 2 armies to advance (must leave 1 behind)
+            // Weakest adjacent enemy from this territory (cached by the plan until its neighbourhood changes)
+            weakestEnemy = plan_.weakestEnemyOf(source);
+            if (weakestEnemy) {
+                attacker = source;
+                return false;
+            }
+            if (!consolidationSource && source != strongest && source->isAdjacentTo(strongest)) {
+                consolidationSource = source;
             }
         }
-        
-        // If this territory has an adjacent enemy, attack it
-        if (weakestEnemy) {
-            AdvanceOrder* advanceOrder = new AdvanceOrder(
-                player_, source, weakestEnemy, source->getArmies() - 1
-            );
-            player_->getOrdersList()->add(advanceOrder);
-            std::cout << "[AggressivePlayerStrategy] Advancing from " << source->getName()
-                      << " to attack " << weakestEnemy->getName() << "\n";
-            return true;
-        }
-    }
+        return budget.step(); // out of budget: stop scanning weaker sources
+    });
     
-    return false;
+    if (!attacker) {
+        return false;
+    }
+    AdvanceOrder* advanceOrder = new AdvanceOrder(
+        player_, attacker, weakestEnemy, attacker->getArmies() - 1
+    );
+    if (!player_->getOrdersList()->add(advanceOrder)) return false;
+    std::cout << "[AggressivePlayerStrategy] Advancing from " << attacker->getName()
+              << " to attack " << weakestEnemy->getName() << "\n";
+    return true;
 }
 
 /**
- * @brief Consolidate armies from weaker owned territories to the strongest territory
+ * @brief Consolidate armies from a weaker owned territory to the strongest territory
  * 
  * @details This is the third priority action for aggressive players, executed only when no
- * enemy territories are adjacent to any owned territories. Moves armies from weaker territories
- * to the strongest territory to concentrate forces for future attacks. Only moves armies from
- * territories that are directly adjacent to the strongest territory.
- * 
- * Strategy:
- * - Identifies the strongest owned territory (most armies)
- * - Iterates through other owned territories (weakest first after strongest)
- * - For each territory adjacent to the strongest with at least 2 armies
- * - Creates an AdvanceOrder to move all available armies (armies - 1) to strongest
- * - Returns immediately after issuing one consolidation order
+ * enemy territory was found to attack. Moves armies from a weaker territory to the strongest
+ * territory to concentrate forces for future attacks. The source is the strongest other territory
+ * adjacent to the strongest one with at least 2 armies; attackAdjacentEnemies() picks it during
+ * its scan.
  * 
+ * @param source Territory to move armies from (nullptr: nothing to consolidate)
  * @return true if a consolidation order was issued
- * @return false if no territories are adjacent to the strongest or have armies to move
+ * @return false if there is no source or the order was refused
  * 
  * @pre player_ must own at least two territories
  * @post An AdvanceOrder from a weaker territory to the strongest is added if successful
  */
-bool AggressivePlayerStrategy::consolidateToStrongest() {
-    std::vector<Territory*> defendList = toDefend(); // Sorted strongest first
-    
-    if (defendList.empty()) {
+bool AggressivePlayerStrategy::consolidateToStrongest(Territory* source) {
+    Territory* strongest = plan_.strongest();
+    if (!source || !strongest) {
         return false;
     }
     
-    Territory* strongest = defendList.front();
-    for (size_t i = 1; i < defendList.size(); ++i) {
-        Territory* source = defendList[i];
-        
-        // Check if source is adjacent to strongest and has armies to move
-        if (source->isAdjacentTo(strongest) && source->getArmies() > 1) {
-            AdvanceOrder* advanceOrder = new AdvanceOrder(
-                player_, source, strongest, source->getArmies() - 1
-            );
-            player_->getOrdersList()->add(advanceOrder);
-            std::cout << "[AggressivePlayerStrategy] Consolidating armies from " 
-                      << source->getName() << " to strongest territory " 
-                      << strongest->getName() << "\n";
-            return true;
-        }
-    }
-    
-    return false;
+    AdvanceOrder* advanceOrder = new AdvanceOrder(
+        player_, source, strongest, source->getArmies() - 1
+    );
+    if (!player_->getOrdersList()->add(advanceOrder)) return false;
+    std::cout << "[AggressivePlayerStrategy] Consolidating armies from " 
+              << source->getName() << " to strongest territory " 
+              << strongest->getName() << "\n";
+    return true;
 }
 
 /**
@@ -263,21 +308,44 @@ bool AggressivePlayerStrategy::consolidateToStrongest() {
  * @see consolidateToStrongest() for consolidation logic
  */
 bool AggressivePlayerStrategy::issueOrder() {
+    DecisionBudget unlimited;
+    return issueOrderWithin(unlimited);
+}
+
+/**
+ * @brief Anytime variant of issueOrder()
+ * 
+ * @details Same priorities as issueOrder(). A rebuild of the plan (first call, or a plan out of
+ * sync with the player) is charged to the budget, one step per owned territory. Deployment is
+ * always decided (it only needs the strongest territory). The attack scan then examines source
+ * territories strongest first and stops when the budget runs out; if it found no attack by then,
+ * the consolidation move found along the way is issued instead, so the player always gets the
+ * best order the budget allowed and the cost of one call is bounded on huge maps.
+ * 
+ * @param budget Time/iteration budget; one step is one source territory examined
+ * @return true if an order was issued within the budget
+ */
+bool AggressivePlayerStrategy::issueOrderWithin(DecisionBudget& budget) {
+    if (player_ && plan_.attach(player_)) {
+        budget.step(static_cast<long>(plan_.getOwnedCount())); // the rebuild sorted every owned territory
+    }
+
     // Priority 1: Deploy all reinforcements to strongest territory
     if (deployToStrongest()) {
         return true;
     }
     
     // Priority 2: Attack adjacent enemies from any territory (prioritize strongest)
-    if (attackAdjacentEnemies()) {
+    Territory* consolidationSource = nullptr;
+    if (attackAdjacentEnemies(budget, consolidationSource)) {
         return true;
     }
     
-    // Priority 3: Consolidate armies to strongest territory if no attacks possible
-    // @note This code will likely never be hit because this would only happen if the player owns
-    // all territories and thus has no adjacent enemies to attack. 
-    // TODO: Confirm if this is desired behavior or if it should be moved before the attack.
-    if (consolidateToStrongest()) {
+    // Priority 3: Consolidate armies to strongest territory if no attacks possible (or none was
+    // found within the budget)
+    // @note Without a budget this is only hit when no owned territory borders an enemy with
+    // armies to spare, e.g. when the player owns every territory around its staging area.
+    if (consolidateToStrongest(consolidationSource)) {
         return true;
     }
     
@@ -310,7 +378,7 @@ bool AggressivePlayerStrategy::issueOrder(Order* orderIssued) {
     
     // Accept only Bomb and Airlift (aggressive cards)
     if (bombOrder || airliftOrder) {
-        player_->getOrdersList()->add(orderIssued);
+        if (!player_->getOrdersList()->add(orderIssued)) return false;
         return true;
     }
     
@@ -343,7 +411,7 @@ static bool playDefensiveCardIfAvailable(Player* player) {
                 if (!weakest) break;
                 Order* order = new BlockadeOrder(player, weakest);
                 if (order->validate()) {
-                    player->getOrdersList()->add(order);
+                    if (!player->getOrdersList()->add(order)) return false;
                     hand->removeCard(card);
                     delete card; // return to deck is not available here; free to avoid leak
                     std::cout << "Benevolent plays Blockade on " << weakest->getName() << "\n";
@@ -363,11 +431,11 @@ static bool playDefensiveCardIfAvailable(Player* player) {
                     if (!target || t->getArmies() < target->getArmies()) target = t;
                 }
                 if (!source || !target || source == target) break;
-                int amount = source->getArmies() - 1;
+                ArmyCount amount = source->getArmies() - 1;
                 if (amount <= 0) break;
                 Order* order = new AirliftOrder(player, source, target, amount);
                 if (order->validate()) {
-                    player->getOrdersList()->add(order);
+                    if (!player->getOrdersList()->add(order)) return false;
                     hand->removeCard(card);
                     delete card;
                     std::cout << "Benevolent plays Airlift from " << source->getName() << " to " << target->getName() << "\n";
@@ -385,7 +453,7 @@ static bool playDefensiveCardIfAvailable(Player* player) {
                         if (other && other != player) {
                             Order* order = new NegotiateOrder(player, other);
                             if (order->validate()) {
-                                player->getOrdersList()->add(order);
+                                if (!player->getOrdersList()->add(order)) return false;
                                 hand->removeCard(card);
                                 delete card;
                                 std::cout << "Benevolent plays Diplomacy with " << other->getPlayerName() << "\n";
@@ -404,17 +472,18 @@ static bool playDefensiveCardIfAvailable(Player* player) {
     return false;
 }
 
-static bool benevolentDeployPhase(Player* player) {
+static bool benevolentDeployPhase(Player* player, DecisionBudget& budget) {
     if (!player) return false;
     if (player->getReinforcementPool() <= 0) return false;
     std::vector<Territory*> defendList = player->toDefend();
+    budget.step(static_cast<long>(defendList.size())); // the deploy is always decided; the sort is still charged
     if (defendList.empty()) return false;
     Territory* weakest = defendList.front();
     int deployAmount = player->getReinforcementPool();
     if (deployAmount <= 0) return false;
     Order* deployOrder = new DeployOrder(player, weakest, deployAmount);
     if (deployOrder->validate()) {
-        player->getOrdersList()->add(deployOrder);
+        if (!player->getOrdersList()->add(deployOrder)) return false;
         player->subtractFromReinforcementPool(deployAmount);
         std::cout << "Player " << player->getPlayerName() << " issues Deploy(" << deployAmount
                   << " on " << weakest->getName() << ")\n";
@@ -424,7 +493,8 @@ static bool benevolentDeployPhase(Player* player) {
     return false;
 }
 
-static bool benevolentRedistributePhase(Player* player) {
+// Anytime: the source is the strongest territory examined before the budget ran out
+static bool benevolentRedistributePhase(Player* player, DecisionBudget& budget) {
     if (!player) return false;
     std::vector<Territory*> owned = player->getOwnedTerritories();
     if (owned.size() <= 1) return false;
@@ -434,6 +504,7 @@ static bool benevolentRedistributePhase(Player* player) {
         if (t->getArmies() > 1) {
             if (!source || t->getArmies() > source->getArmies()) source = t;
         }
+        if (!budget.step()) break;
     }
     if (!source) return false;
     Territory* target = nullptr;
@@ -445,11 +516,11 @@ static bool benevolentRedistributePhase(Player* player) {
     }
     if (!target) return false;
     if (target->getArmies() >= source->getArmies()) return false;
-    int advanceAmount = source->getArmies() - 1;
+    ArmyCount advanceAmount = source->getArmies() - 1;
     if (advanceAmount <= 0) return false;
     Order* adv = new AdvanceOrder(player, source, target, advanceAmount);
     if (adv->validate()) {
-        player->getOrdersList()->add(adv);
+        if (!player->getOrdersList()->add(adv)) return false;
         std::cout << "Player " << player->getPlayerName() << " issues Advance(" << advanceAmount
                   << " from " << source->getName() << " to " << target->getName() << ")\n";
         return true;
@@ -486,6 +557,8 @@ PlayerStrategy* BenevolentPlayerStrategy::clone() const {
     return new BenevolentPlayerStrategy(*this);
 }
 
+const char* BenevolentPlayerStrategy::getStrategyName() const { return "Benevolent"; }
+
 std::ostream& operator<<(std::ostream& os, const BenevolentPlayerStrategy& ps) {
     (void)ps;
     os << "BenevolentPlayerStrategy";
@@ -521,18 +594,36 @@ std::vector<Territory*> BenevolentPlayerStrategy::toAttack() {
  3. May use cards defensively (Blockade, Diplomacy) but never to harm others
 */
 bool BenevolentPlayerStrategy::issueOrder() {
+    DecisionBudget unlimited;
+    return issueOrderWithin(unlimited);
+}
+
+/**
+ * @brief Anytime variant of issueOrder()
+ * @details The deploy is always decided (its sort is charged to the budget). A defensive card is
+ * only looked for while the budget lasts, one step per card in hand. The redistribution scan moves
+ * armies from the strongest territory it examined before the budget ran out.
+ * @param budget Time/iteration budget; one step is one owned territory examined
+ * @return true if an order was issued within the budget
+ */
+bool BenevolentPlayerStrategy::issueOrderWithin(DecisionBudget& budget) {
     if (!player_) return false;
 
     // (A) Deploy phase
     if (player_->getReinforcementPool() > 0) {
-        return benevolentDeployPhase(player_);
+        return benevolentDeployPhase(player_, budget);
     }
 
     // (B) Try to play a defensive card first (if any)
-    if (playDefensiveCardIfAvailable(player_)) return true;
+    const Hand* hand = player_->getPlayerHand();
+    if (hand && budget.step(static_cast<long>(hand->getCardsOnHand().size()))
+        && playDefensiveCardIfAvailable(player_)) {
+        return true;
+    }
+    if (budget.exhausted()) return false;
 
     // (C) Defensive redistribution
-    return benevolentRedistributePhase(player_);
+    return benevolentRedistributePhase(player_, budget);
 }
 
 bool BenevolentPlayerStrategy::issueOrder(Order* orderIssued) {
@@ -551,12 +642,12 @@ bool BenevolentPlayerStrategy::issueOrder(Order* orderIssued) {
         // the purposes of card-created orders, accept Deploy orders targeted at
         // this player and add them to the OrdersList without requiring validate()
         // to succeed on reinforcement pool.
-        player_->getOrdersList()->add(orderIssued);
+        if (!player_->getOrdersList()->add(orderIssued)) return false;
         return true;
     }
     if (oname == "Blockade" || oname == "Airlift" || oname == "Negotiate") {
         if (orderIssued->validate()) {
-            player_->getOrdersList()->add(orderIssued);
+            if (!player_->getOrdersList()->add(orderIssued)) return false;
             return true;
         } else {
             delete orderIssued;
@@ -592,6 +683,8 @@ PlayerStrategy* NeutralPlayerStrategy::clone() const {
     return new NeutralPlayerStrategy(*this);
 }
 
+const char* NeutralPlayerStrategy::getStrategyName() const { return "Neutral"; }
+
 std::ostream& operator<<(std::ostream& os, const NeutralPlayerStrategy& ps) {
     (void)ps;
     os << "NeutralPlayerStrategy";
@@ -647,6 +740,9 @@ HumanPlayerStrategy::HumanPlayerStrategy() : PlayerStrategy() {}
 
 HumanPlayerStrategy::~HumanPlayerStrategy() = default;
 
+/** The human decides at the console, so engine time budgets do not apply */
+bool HumanPlayerStrategy::isInteractive() const { return true; }
+
 HumanPlayerStrategy::HumanPlayerStrategy(const HumanPlayerStrategy& other)
     : PlayerStrategy(other) {
     // Copy any HumanPlayerStrategy-specific members here if added in future
@@ -664,6 +760,8 @@ PlayerStrategy* HumanPlayerStrategy::clone() const {
     return new HumanPlayerStrategy(*this);
 }
 
+const char* HumanPlayerStrategy::getStrategyName() const { return "Human"; }
+
 std::ostream& operator<<(std::ostream& os, const HumanPlayerStrategy& ps) {
     (void)ps;
     os << "HumanPlayerStrategy";
@@ -682,13 +780,14 @@ std::vector<Territory*> HumanPlayerStrategy::toDefend() {
 std::vector<Territory*> HumanPlayerStrategy::toAttack() {
     std::vector<Territory*> attackList;
     if (!player_) return attackList;
+    TerritoryBitset listed; // ids already in attackList
     for (Territory* mine : player_->getOwnedTerritories()) {
         if (!mine) continue;
         for (Territory* adj : mine->getAdjacents()) {
             if (!adj) continue;
             Player* owner = adj->getOwner();
-            if (owner != player_ && owner != nullptr &&
-                std::find(attackList.begin(), attackList.end(), adj) == attackList.end()) {
+            if (owner != player_ && owner != nullptr && !listed.test(adj->getId())) {
+                listed.set(adj->getId());
                 attackList.push_back(adj);
             }
         }
@@ -759,7 +858,7 @@ bool HumanPlayerStrategy::issueOrder() {
         int amt = readInt(1, pool);
         Order* deploy = new DeployOrder(player_, target, amt);
         if (deploy->validate()) {
-            player_->getOrdersList()->add(deploy);
+            if (!player_->getOrdersList()->add(deploy)) return false;
             player_->subtractFromReinforcementPool(amt);
             std::cout << "Issued Deploy(" << amt << " on " << target->getName() << ")\n";
             return true;
@@ -817,12 +916,12 @@ bool HumanPlayerStrategy::issueOrder() {
         std::cout << "Choice: ";
         int tidx = readInt(1, (int)validTargets.size()) - 1;
         Territory* target = validTargets[tidx];
-        int maxMove = source->getArmies() - 1;
+        int maxMove = Armies::toInt(source->getArmies() - 1);
         std::cout << "Enter number of armies to advance (1-" << maxMove << "): ";
         int amt = readInt(1, maxMove);
         Order* adv = new AdvanceOrder(player_, source, target, amt);
         if (adv->validate()) {
-            player_->getOrdersList()->add(adv);
+            if (!player_->getOrdersList()->add(adv)) return false;
             std::cout << "Issued Advance(" << amt << " from " << source->getName() << " to " << target->getName() << ")\n";
             return true;
         }
@@ -863,7 +962,7 @@ bool HumanPlayerStrategy::issueOrder() {
                 int targ = readInt(1, (int)attackable.size()) - 1;
                 Order* bomb = new BombOrder(player_, attackable[targ]);
                 if (bomb->validate()) {
-                    player_->getOrdersList()->add(bomb);
+                    if (!player_->getOrdersList()->add(bomb)) return false;
                     hand->removeCard(chosen);
                     delete chosen;
                     std::cout << "Played Bomb on " << attackable[targ]->getName() << "\n";
@@ -883,7 +982,7 @@ bool HumanPlayerStrategy::issueOrder() {
                 int tid = readInt(1, (int)owned.size()) - 1;
                 Order* block = new BlockadeOrder(player_, owned[tid]);
                 if (block->validate()) {
-                    player_->getOrdersList()->add(block);
+                    if (!player_->getOrdersList()->add(block)) return false;
                     hand->removeCard(chosen);
                     delete chosen;
                     std::cout << "Played Blockade on " << owned[tid]->getName() << "\n";
@@ -910,12 +1009,12 @@ bool HumanPlayerStrategy::issueOrder() {
                 std::cout << "Choice: ";
                 int d = readInt(1, (int)owned.size()) - 1;
                 Territory* dst = owned[d];
-                int maxMove = src->getArmies() - 1;
+                int maxMove = Armies::toInt(src->getArmies() - 1);
                 std::cout << "Enter number of armies to airlift (1-" << maxMove << "): ";
                 int amt = readInt(1, maxMove);
                 Order* air = new AirliftOrder(player_, src, dst, amt);
                 if (air->validate()) {
-                    player_->getOrdersList()->add(air);
+                    if (!player_->getOrdersList()->add(air)) return false;
                     hand->removeCard(chosen);
                     delete chosen;
                     std::cout << "Played Airlift from " << src->getName() << " to " << dst->getName() << "\n";
@@ -944,7 +1043,7 @@ bool HumanPlayerStrategy::issueOrder() {
                 int pidx = readInt(1, (int)candidates.size()) - 1;
                 Order* neg = new NegotiateOrder(player_, candidates[pidx]);
                 if (neg->validate()) {
-                    player_->getOrdersList()->add(neg);
+                    if (!player_->getOrdersList()->add(neg)) return false;
                     hand->removeCard(chosen);
                     delete chosen;
                     std::cout << "Played Diplomacy with " << candidates[pidx]->getPlayerName() << "\n";
@@ -967,7 +1066,7 @@ bool HumanPlayerStrategy::issueOrder() {
                 int amt = readInt(1, 1000000);
                 Order* d = new DeployOrder(player_, owned[tid], amt);
                 if (d->validate()) {
-                    player_->getOrdersList()->add(d);
+                    if (!player_->getOrdersList()->add(d)) return false;
                     hand->removeCard(chosen);
                     delete chosen;
                     std::cout << "Played Reinforcement deploying " << amt << " to " << owned[tid]->getName() << "\n";
@@ -994,7 +1093,7 @@ bool HumanPlayerStrategy::issueOrder(Order* orderIssued) {
 
     // Validate and accept the externally-created order when possible
     if (orderIssued->validate()) {
-        player_->getOrdersList()->add(orderIssued);
+        if (!player_->getOrdersList()->add(orderIssued)) return false;
         return true;
     }
     delete orderIssued;
@@ -1004,19 +1103,21 @@ bool HumanPlayerStrategy::issueOrder(Order* orderIssued) {
 // ====================== CheaterPlayerStrategy =======================
 
 // Cheater helpers (local to cheater strategy)
-static std::vector<Territory*> cheaterCollectTargets(Player* player) {
+// Anytime: collects the enemies around the owned territories examined before the budget ran out
+static std::vector<Territory*> cheaterCollectTargets(Player* player, DecisionBudget& budget) {
     std::vector<Territory*> toConquer;
     if (!player) return toConquer;
+    TerritoryBitset listed; // ids already in toConquer
     for (Territory* mine : player->getOwnedTerritories()) {
         if (!mine) continue;
         for (Territory* adj : mine->getAdjacents()) {
             if (!adj) continue;
-            if (adj->getOwner() != player) {
-                if (std::find(toConquer.begin(), toConquer.end(), adj) == toConquer.end()) {
-                    toConquer.push_back(adj);
-                }
+            if (adj->getOwner() != player && !listed.test(adj->getId())) {
+                listed.set(adj->getId());
+                toConquer.push_back(adj);
             }
         }
+        if (!budget.step()) break;
     }
     return toConquer;
 }
@@ -1065,6 +1166,8 @@ PlayerStrategy* CheaterPlayerStrategy::clone() const {
     return new CheaterPlayerStrategy(*this);
 }
 
+const char* CheaterPlayerStrategy::getStrategyName() const { return "Cheater"; }
+
 void CheaterPlayerStrategy::resetForNewRound() {
     actedThisRound_ = false;
 }
@@ -1091,10 +1194,20 @@ std::vector<Territory*> CheaterPlayerStrategy::toAttack() {
  4. Print conquest messages
  5. Return true if any territory was conquered, false otherwise */
 bool CheaterPlayerStrategy::issueOrder() {
+    DecisionBudget unlimited;
+    return issueOrderWithin(unlimited);
+}
+
+/**
+ * @brief Anytime variant of issueOrder(): conquers the enemies found within the budget
+ * @param budget Time/iteration budget; one step is one owned territory whose neighbours were collected
+ * @return true if any territory was conquered
+ */
+bool CheaterPlayerStrategy::issueOrderWithin(DecisionBudget& budget) {
     if (!player_) return false;
     // Only allow one automatic conquest per issuing-phase
     if (actedThisRound_) return false;
-    auto targets = cheaterCollectTargets(player_);
+    auto targets = cheaterCollectTargets(player_, budget);
     bool res = cheaterConquerTargets(player_, targets);
     if (res) actedThisRound_ = true;
     return res;
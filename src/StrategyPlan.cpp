@@ -0,0 +1,159 @@
+/**
+ * @file StrategyPlan.cpp
+ * @brief Persistent strategy plan kept in sync through territory notifications.
+ */
+
+#include "../include/StrategyPlan.h"
+#include "../include/Player.h"
+#include <limits>
+#include <ostream>
+
+StrategyPlan::StrategyPlan()
+    : player(nullptr), rebuilds(0), targetsRecomputed(0), targetsReused(0) {}
+
+StrategyPlan::~StrategyPlan() {
+    clear();
+}
+
+/**
+ * @brief Follow a player, rebuilding the plan only when it cannot be trusted
+ * @param newPlayer Player whose territories the plan describes (nullptr detaches)
+ * @return true if the plan was rebuilt (a full pass over the player's territories)
+ */
+bool StrategyPlan::attach(Player* newPlayer) {
+    if (!newPlayer) {
+        clear();
+        player = nullptr;
+        return false;
+    }
+    if (newPlayer != player || newPlayer->getTerritoryCount() != owned.size()) {
+        player = newPlayer;
+        rebuild();
+        return true;
+    }
+    return false;
+}
+
+/** @brief Stop listening to every territory and drop the cached intent */
+void StrategyPlan::clear() {
+    for (Territory* t : listened) t->removeListener(this);
+    listened.clear();
+    owned.clear();
+    targets.clear();
+}
+
+/** @brief Full recomputation from the player's territories */
+void StrategyPlan::rebuild() {
+    clear();
+    ++rebuilds;
+    for (Territory* t : player->getOwnedTerritories()) {
+        if (t) addOwned(t);
+    }
+}
+
+void StrategyPlan::listenTo(Territory* territory) {
+    if (listened.insert(territory).second) territory->addListener(this);
+}
+
+/** @brief Track an owned territory and the neighbours its target depends on */
+void StrategyPlan::addOwned(Territory* territory) {
+    owned.emplace(-territory->getArmies(), territory->getId(), territory);
+    targets[territory] = Target();
+    listenTo(territory);
+    for (Territory* adj : territory->getAdjacents()) {
+        if (adj) listenTo(adj);
+    }
+}
+
+void StrategyPlan::removeOwned(Territory* territory, ArmyCount armies) {
+    owned.erase(StrengthKey(-armies, territory->getId(), territory));
+    targets.erase(territory);
+}
+
+/** @brief Mark the targets of the owned territories next to (and at) a changed territory as stale */
+void StrategyPlan::invalidateAround(const Territory* territory) {
+    auto self = targets.find(territory);
+    if (self != targets.end()) self->second.stale = true;
+    for (const Territory* adj : territory->getAdjacents()) {
+        auto it = targets.find(adj);
+        if (it != targets.end()) it->second.stale = true;
+    }
+}
+
+/**
+ * @brief Apply one board change to the plan
+ * @details Own army changes only reorder the staging list; ownership changes and enemy army
+ *          changes invalidate the attack targets of the neighbouring owned territories.
+ */
+void StrategyPlan::territoryChanged(const Territory& territory, Player* previousOwner, ArmyCount previousArmies) {
+    if (!player) return;
+    Territory* t = const_cast<Territory*>(&territory); // the plan hands territories back to the strategy
+    const bool wasMine = previousOwner == player;
+    const bool isMine = territory.getOwner() == player;
+
+    if (wasMine && isMine) {
+        owned.erase(StrengthKey(-previousArmies, territory.getId(), t));
+        owned.emplace(-territory.getArmies(), territory.getId(), t);
+        return;
+    }
+    if (wasMine) removeOwned(t, previousArmies);
+    if (isMine) addOwned(t);
+    invalidateAround(t);
+}
+
+/** @brief The map is going away: forget the territory, rebuild on the next attach() */
+void StrategyPlan::territoryDestroyed(const Territory& territory) {
+    listened.erase(const_cast<Territory*>(&territory));
+    owned.clear();
+    targets.clear();
+}
+
+Territory* StrategyPlan::strongest() const {
+    return owned.empty() ? nullptr : std::get<2>(*owned.begin());
+}
+
+std::vector<Territory*> StrategyPlan::strongestFirst() const {
+    std::vector<Territory*> ordered;
+    ordered.reserve(owned.size());
+    for (const StrengthKey& key : owned) ordered.push_back(std::get<2>(key));
+    return ordered;
+}
+
+/**
+ * @brief Weakest enemy territory adjacent to an owned territory
+ * @param source Owned territory
+ * @return Cached target, recomputed only if the neighbourhood changed since it was computed
+ */
+Territory* StrategyPlan::weakestEnemyOf(Territory* source) {
+    auto it = targets.find(source);
+    if (it == targets.end()) return nullptr;
+
+    Target& target = it->second;
+    if (!target.stale) {
+        ++targetsReused;
+        return target.enemy;
+    }
+
+    ++targetsRecomputed;
+    target.enemy = nullptr;
+    ArmyCount minEnemyArmies = std::numeric_limits<ArmyCount>::max();
+    for (Territory* adj : source->getAdjacents()) {
+        if (adj && adj->getOwner() != player && adj->getOwner() != nullptr && adj->getArmies() < minEnemyArmies) {
+            minEnemyArmies = adj->getArmies();
+            target.enemy = adj;
+        }
+    }
+    target.stale = false;
+    return target.enemy;
+}
+
+std::size_t StrategyPlan::getOwnedCount() const { return owned.size(); }
+std::size_t StrategyPlan::getRebuilds() const { return rebuilds; }
+std::size_t StrategyPlan::getTargetsRecomputed() const { return targetsRecomputed; }
+std::size_t StrategyPlan::getTargetsReused() const { return targetsReused; }
+
+std::ostream& operator<<(std::ostream& os, const StrategyPlan& plan) {
+    os << "StrategyPlan [owned: " << plan.owned.size() << ", rebuilds: " << plan.rebuilds
+       << ", targets recomputed: " << plan.targetsRecomputed << ", reused: " << plan.targetsReused << "]";
+    return os;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file StrategyRegistry.cpp
+ * @brief Strategy registry (built-in strategies) and strategy pool implementation.
+ */
+
+#include "../include/StrategyRegistry.h"
+#include "../include/PlayerStrategies.h"
+#include <algorithm>
+#include <ostream>
+
+namespace {
+    template <class Strategy>
+    PlayerStrategy* makeStrategy() {
+        return new Strategy();
+    }
+}
+
+// ======================= StrategyRegistry =======================
+
+/** @brief Registers the built-in strategies under their strategy names */
+StrategyRegistry::StrategyRegistry() {
+    registerStrategy("Aggressive", &makeStrategy<AggressivePlayerStrategy>);
+    registerStrategy("Benevolent", &makeStrategy<BenevolentPlayerStrategy>);
+    registerStrategy("Neutral", &makeStrategy<NeutralPlayerStrategy>);
+    registerStrategy("Cheater", &makeStrategy<CheaterPlayerStrategy>);
+    registerStrategy("Human", &makeStrategy<HumanPlayerStrategy>, true);
+}
+
+/** @brief Process-wide registry, built on first use */
+StrategyRegistry& StrategyRegistry::instance() {
+    static StrategyRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Register a strategy factory
+ * @param name Strategy name; must match getStrategyName() of the strategies the factory builds
+ * @param factory Function returning a new strategy
+ * @param interactive True if the strategy waits on the user
+ * @return false if the name is already registered (the existing factory is kept)
+ */
+bool StrategyRegistry::registerStrategy(const std::string& name, Factory factory, bool interactive) {
+    if (!factory) return false;
+    return entries.emplace(name, Entry{factory, interactive}).second;
+}
+
+PlayerStrategy* StrategyRegistry::create(const std::string& name) const {
+    auto it = entries.find(name);
+    return it == entries.end() ? nullptr : it->second.factory();
+}
+
+bool StrategyRegistry::contains(const std::string& name) const {
+    return entries.find(name) != entries.end();
+}
+
+bool StrategyRegistry::isInteractive(const std::string& name) const {
+    auto it = entries.find(name);
+    return it != entries.end() && it->second.interactive;
+}
+
+std::vector<std::string> StrategyRegistry::getNames() const {
+    std::vector<std::string> names;
+    names.reserve(entries.size());
+    for (const auto& entry : entries) names.push_back(entry.first);
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::ostream& operator<<(std::ostream& os, const StrategyRegistry& registry) {
+    os << "StrategyRegistry [";
+    const std::vector<std::string> names = registry.getNames();
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        if (i) os << ", ";
+        os << names[i];
+    }
+    os << "]";
+    return os;
+}
+
+// ======================= StrategyPool =======================
+
+StrategyPool::StrategyPool() : created(0), reused(0) {}
+
+StrategyPool::~StrategyPool() {
+    for (auto& entry : available) {
+        for (PlayerStrategy* strategy : entry.second) delete strategy;
+    }
+}
+
+/**
+ * @brief Take a strategy out of the pool, creating it through the registry if none is pooled
+ * @param name Registered strategy name
+ * @return Strategy owned by the caller until released, or nullptr if the name is unknown
+ */
+PlayerStrategy* StrategyPool::acquire(const std::string& name) {
+    auto it = available.find(name);
+    if (it != available.end() && !it->second.empty()) {
+        PlayerStrategy* strategy = it->second.back();
+        it->second.pop_back();
+        ++reused;
+        return strategy;
+    }
+
+    PlayerStrategy* strategy = StrategyRegistry::instance().create(name);
+    if (strategy) ++created;
+    return strategy;
+}
+
+/**
+ * @brief Return a strategy to the pool after its game ended
+ * @param strategy Strategy given up by its player (ownership moves to the pool)
+ */
+void StrategyPool::release(PlayerStrategy* strategy) {
+    if (!strategy) return;
+    strategy->resetForNewGame();
+    available[strategy->getStrategyName()].push_back(strategy);
+}
+
+std::size_t StrategyPool::getCreated() const { return created; }
+std::size_t StrategyPool::getReused() const { return reused; }
+
+std::size_t StrategyPool::getPooled() const {
+    std::size_t pooled = 0;
+    for (const auto& entry : available) pooled += entry.second.size();
+    return pooled;
+}
+
+std::ostream& operator<<(std::ostream& os, const StrategyPool& pool) {
+    os << "StrategyPool [created: " << pool.created << ", reused: " << pool.reused
+       << ", pooled: " << pool.getPooled() << "]";
+    return os;
+}
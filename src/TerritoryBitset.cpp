@@ -0,0 +1,135 @@
+/**
+ * @file TerritoryBitset.cpp
+ * @brief Word-parallel territory sets (see TerritoryBitset.h).
+ *
+ * @details Operands may have different lengths: missing words are zero, so every operation only
+ *          walks the words both sides can have in common (or the words of the left operand).
+ */
+
+#include <algorithm>
+#include <ostream>
+#include "../include/TerritoryBitset.h"
+
+namespace {
+    const int WORD_BITS = 64;
+
+    /** @brief Number of set bits of a word */
+    int popcount(std::uint64_t word) {
+        int bits = 0;
+        for (; word; word &= word - 1) ++bits;
+        return bits;
+    }
+}
+
+/** @brief Add a territory id to the set */
+void TerritoryBitset::set(int id) {
+    if (id < 0) return;
+    const std::size_t word = static_cast<std::size_t>(id / WORD_BITS);
+    if (word >= words.size()) words.resize(word + 1, 0);
+    words[word] |= std::uint64_t(1) << (id % WORD_BITS);
+}
+
+/** @brief Remove a territory id from the set */
+void TerritoryBitset::reset(int id) {
+    if (id < 0) return;
+    const std::size_t word = static_cast<std::size_t>(id / WORD_BITS);
+    if (word < words.size()) words[word] &= ~(std::uint64_t(1) << (id % WORD_BITS));
+}
+
+/** @brief Whether a territory id is in the set */
+bool TerritoryBitset::test(int id) const {
+    if (id < 0) return false;
+    const std::size_t word = static_cast<std::size_t>(id / WORD_BITS);
+    return word < words.size() && (words[word] >> (id % WORD_BITS) & 1) != 0;
+}
+
+/** @brief Remove every id (keeps the capacity) */
+void TerritoryBitset::clear() { std::fill(words.begin(), words.end(), 0); }
+
+/** @brief Whether the set has at least one member */
+bool TerritoryBitset::any() const {
+    return std::any_of(words.begin(), words.end(), [](std::uint64_t w) { return w != 0; });
+}
+
+/** @brief Number of members */
+std::size_t TerritoryBitset::count() const {
+    std::size_t bits = 0;
+    for (std::uint64_t w : words) bits += static_cast<std::size_t>(popcount(w));
+    return bits;
+}
+
+/**
+ * @brief Whether the two sets share a member
+ * @complexity O(min(words)) word ANDs
+ */
+bool TerritoryBitset::intersects(const TerritoryBitset& other) const {
+    const std::size_t common = std::min(words.size(), other.words.size());
+    for (std::size_t i = 0; i < common; ++i) {
+        if (words[i] & other.words[i]) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Whether every member of this set is in the other set
+ * @complexity O(words) word AND-NOTs
+ */
+bool TerritoryBitset::isSubsetOf(const TerritoryBitset& other) const {
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        const std::uint64_t theirs = i < other.words.size() ? other.words[i] : 0;
+        if (words[i] & ~theirs) return false;
+    }
+    return true;
+}
+
+/** @brief Union with another set */
+TerritoryBitset& TerritoryBitset::operator|=(const TerritoryBitset& other) {
+    if (other.words.size() > words.size()) words.resize(other.words.size(), 0);
+    for (std::size_t i = 0; i < other.words.size(); ++i) words[i] |= other.words[i];
+    return *this;
+}
+
+/** @brief Intersection with another set */
+TerritoryBitset& TerritoryBitset::operator&=(const TerritoryBitset& other) {
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        words[i] &= i < other.words.size() ? other.words[i] : 0;
+    }
+    return *this;
+}
+
+/** @brief Remove the members of another set */
+TerritoryBitset& TerritoryBitset::subtract(const TerritoryBitset& other) {
+    const std::size_t common = std::min(words.size(), other.words.size());
+    for (std::size_t i = 0; i < common; ++i) words[i] &= ~other.words[i];
+    return *this;
+}
+
+/** @brief Members in increasing id order */
+std::vector<int> TerritoryBitset::ids() const {
+    std::vector<int> members;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        for (std::uint64_t w = words[i]; w; w &= w - 1) {
+            int bit = 0;
+            while (!(w >> bit & 1)) ++bit;
+            members.push_back(static_cast<int>(i) * WORD_BITS + bit);
+        }
+    }
+    return members;
+}
+
+/** @brief Same members (trailing empty words do not matter) */
+bool operator==(const TerritoryBitset& a, const TerritoryBitset& b) {
+    return a.isSubsetOf(b) && b.isSubsetOf(a);
+}
+
+/** @brief Print the member ids, e.g. "{1, 4, 9}" */
+std::ostream& operator<<(std::ostream& os, const TerritoryBitset& set) {
+    os << "{";
+    bool first = true;
+    for (int id : set.ids()) {
+        if (!first) os << ", ";
+        os << id;
+        first = false;
+    }
+    return os << "}";
+}
@@ -0,0 +1,193 @@
+/**
+ * @file TournamentProgress.cpp
+ * @brief Lock-free tournament counters and their background reporter (see TournamentProgress.h).
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "../include/TournamentProgress.h"
+
+/**
+ * @brief Progress of a tournament that starts now
+ * @param mapNames Maps in tournament order
+ * @param gamesPerMap Games played on each map
+ */
+TournamentProgress::TournamentProgress(const std::vector<std::string>& mapNames, int gamesPerMap)
+    : mapNames(mapNames),
+      gamesPerMap(gamesPerMap < 0 ? 0 : gamesPerMap),
+      start(Clock::now()),
+      started(0),
+      completed(0),
+      turns(0),
+      currentMap(-1),
+      currentGameStart(0),
+      mapMicroseconds(mapNames.size()),
+      mapGames(mapNames.size()),
+      stopping(false),
+      interval(0) {}
+
+TournamentProgress::~TournamentProgress() {
+    stopReporting();
+}
+
+std::int64_t TournamentProgress::microsecondsSinceStart() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+}
+
+/** @brief A game of the given map starts (simulation thread) */
+void TournamentProgress::gameStarted(std::size_t map) {
+    currentGameStart.store(microsecondsSinceStart(), std::memory_order_relaxed);
+    currentMap.store(static_cast<int>(map), std::memory_order_relaxed);
+    started.fetch_add(1, std::memory_order_relaxed);
+}
+
+/** @brief The running game of the given map ended (simulation thread) */
+void TournamentProgress::gameFinished(std::size_t map) {
+    const std::int64_t duration = microsecondsSinceStart() - currentGameStart.load(std::memory_order_relaxed);
+    if (map < mapGames.size()) {
+        mapMicroseconds[map].fetch_add(static_cast<std::uint64_t>(duration < 0 ? 0 : duration), std::memory_order_relaxed);
+        mapGames[map].fetch_add(1, std::memory_order_relaxed);
+    }
+    currentMap.store(-1, std::memory_order_relaxed);
+    completed.fetch_add(1, std::memory_order_relaxed);
+}
+
+/** @brief A game finished a turn (simulation thread) */
+void TournamentProgress::turnCompleted() {
+    turns.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Rates, per-map averages and ETA computed from the counters
+ * @details The counters are read one by one without a lock, so a snapshot taken while a game
+ *          starts or ends may be off by that game; the next one is consistent again.
+ */
+TournamentProgressSnapshot TournamentProgress::snapshot() const {
+    TournamentProgressSnapshot s;
+    const std::int64_t now = microsecondsSinceStart();
+    const std::size_t done = completed.load(std::memory_order_relaxed);
+    const std::size_t begun = started.load(std::memory_order_relaxed);
+
+    s.gamesTotal = mapNames.size() * static_cast<std::size_t>(gamesPerMap);
+    s.gamesCompleted = done;
+    s.gamesRunning = begun > done ? begun - done : 0;
+    s.gamesQueued = s.gamesTotal > begun ? s.gamesTotal - begun : 0;
+    s.turnsCompleted = turns.load(std::memory_order_relaxed);
+    s.elapsedSeconds = now / 1e6;
+    if (s.elapsedSeconds > 0.0) {
+        s.gamesPerSecond = done / s.elapsedSeconds;
+        s.turnsPerSecond = s.turnsCompleted / s.elapsedSeconds;
+    }
+    s.mapNames = mapNames;
+    s.currentMap = currentMap.load(std::memory_order_relaxed);
+
+    std::uint64_t totalMicroseconds = 0;
+    std::uint64_t totalGames = 0;
+    std::vector<std::uint64_t> gamesOf(mapNames.size());
+    s.mapAverageSeconds.assign(mapNames.size(), 0.0);
+    for (std::size_t m = 0; m < mapNames.size(); ++m) {
+        const std::uint64_t micros = mapMicroseconds[m].load(std::memory_order_relaxed);
+        gamesOf[m] = mapGames[m].load(std::memory_order_relaxed);
+        if (gamesOf[m] > 0) s.mapAverageSeconds[m] = micros / 1e6 / gamesOf[m];
+        totalMicroseconds += micros;
+        totalGames += gamesOf[m];
+    }
+    if (totalGames == 0) return s;
+
+    // Remaining games of each map at that map's average (the tournament average before it started)
+    const double overallAverage = totalMicroseconds / 1e6 / totalGames;
+    double eta = 0.0;
+    for (std::size_t m = 0; m < mapNames.size(); ++m) {
+        const std::uint64_t left = gamesOf[m] < static_cast<std::uint64_t>(gamesPerMap) ? gamesPerMap - gamesOf[m] : 0;
+        eta += left * (gamesOf[m] > 0 ? s.mapAverageSeconds[m] : overallAverage);
+    }
+    if (s.gamesRunning > 0) {
+        const double running = (now - currentGameStart.load(std::memory_order_relaxed)) / 1e6;
+        eta -= std::min(running, s.currentMap >= 0 && gamesOf[s.currentMap] > 0 ? s.mapAverageSeconds[s.currentMap] : overallAverage);
+    }
+    s.etaSeconds = eta < 0.0 ? 0.0 : eta;
+    return s;
+}
+
+/**
+ * @brief Start the reporter thread (restarts it if it already runs)
+ * @param interval Time between two lines (at least 1 ms)
+ * @param statusPath File whose contents each line replaces; empty for stderr
+ */
+void TournamentProgress::startReporting(std::chrono::milliseconds every, const std::string& path) {
+    stopReporting();
+    {
+        std::lock_guard<std::mutex> lock(reporterMutex);
+        stopping = false;
+        interval = every < std::chrono::milliseconds(1) ? std::chrono::milliseconds(1) : every;
+        statusPath = path;
+    }
+    reporter = std::thread(&TournamentProgress::report, this);
+}
+
+/** @brief Stop the reporter thread after a last line (nothing if it does not run) */
+void TournamentProgress::stopReporting() {
+    if (!reporter.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(reporterMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    reporter.join();
+}
+
+/** @brief Reporter thread: one line per interval, and a last one when stopped */
+void TournamentProgress::report() {
+    std::unique_lock<std::mutex> lock(reporterMutex);
+    while (!wake.wait_for(lock, interval, [this] { return stopping; })) {
+        emit(snapshot());
+    }
+    emit(snapshot());
+}
+
+/** @brief Write one line to stderr, or replace the status file with it */
+void TournamentProgress::emit(const TournamentProgressSnapshot& s) const {
+    std::ostringstream line;
+    line << s;
+    if (statusPath.empty()) {
+        std::cerr << line.str() << std::endl;
+        return;
+    }
+    const std::string aside = statusPath + ".tmp";
+    {
+        std::ofstream out(aside, std::ios::trunc);
+        if (!out) return; // the next interval tries again
+        out << line.str() << '\n';
+    }
+    std::rename(aside.c_str(), statusPath.c_str());
+}
+
+/** @brief Print e.g. "[Progress] 7/30 games done, 1 running, 22 queued | 0.8 games/s, ..." */
+std::ostream& operator<<(std::ostream& os, const TournamentProgressSnapshot& s) {
+    const std::ios::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << std::fixed << std::setprecision(1);
+    os << "[Progress] " << s.gamesCompleted << "/" << s.gamesTotal << " games done, " << s.gamesRunning
+       << " running, " << s.gamesQueued << " queued | " << std::setprecision(2) << s.gamesPerSecond << " games/s, "
+       << std::setprecision(1) << s.turnsPerSecond << " turns/s";
+    if (s.currentMap >= 0 && static_cast<std::size_t>(s.currentMap) < s.mapNames.size()) {
+        os << " | " << s.mapNames[s.currentMap];
+        const double average = s.mapAverageSeconds[s.currentMap];
+        if (average > 0.0) os << " avg " << std::setprecision(2) << average << " s/game";
+    }
+    os << std::setprecision(1) << " | elapsed " << s.elapsedSeconds << " s, ETA ";
+    if (s.etaSeconds < 0.0) os << "unknown";
+    else os << s.etaSeconds << " s";
+    os.flags(flags);
+    os.precision(precision);
+    return os;
+}
+
+/** @brief Print the current snapshot */
+std::ostream& operator<<(std::ostream& os, const TournamentProgress& progress) {
+    return os << progress.snapshot();
+}